@@ -4,7 +4,10 @@
  Description
      source file for the module to call the User event checking routines
  Notes
-     Users should only modify the contents of the ES_EventList array.
+     Users should only modify EVENT_CHECK_SCHEDULE in ES_Configure.h. Each
+     checker is called only when it is due, at its phase and then once per
+     period (in ms), so a checker can be polled at the rate its sensor needs
+     rather than on every pass of the idle loop.
  History
  When           Who     What/Why
  -------------- ---     --------
@@ -15,17 +18,44 @@
 #include "ES_Events.h"
 #include "ES_General.h"
 #include "ES_CheckEvents.h"
+#include "ES_Timers.h"
 #include <BOARD.h>
+#ifdef USE_SERVICE_STATS
+#include <xc.h>
+#include <stdio.h>
+#endif
 
-// Include the header files for the module(s) with your event checkers. 
+// Include the header files for the module(s) with your event checkers.
 // This gets you the prototypes for the event checking functions.
 
 #include EVENT_CHECK_HEADER
 
-// Fill in this array with the names of your event checking functions
+#ifdef EVENT_CHECK_SCHEDULE
+#define CHECK_FUNC(Func, Period, Phase) Func,
+#define CHECK_PERIOD(Func, Period, Phase) Period,
+#define CHECK_PHASE(Func, Period, Phase) Phase,
+#define CHECK_NAME(Func, Period, Phase) #Func,
 
-static CheckFunc * const ES_EventList[]={EVENT_CHECK_LIST };
+// the event checking functions, with how often to call each one
+static CheckFunc * const ES_EventList[]={EVENT_CHECK_SCHEDULE(CHECK_FUNC) };
+static uint16_t const CheckPeriod[]={EVENT_CHECK_SCHEDULE(CHECK_PERIOD) };
 
+// the ES_Timer_GetTime() at which each checker is next due. Starting from
+// the phase keeps every call on the phase, however late the loop gets to it.
+static uint32_t NextDue[]={EVENT_CHECK_SCHEDULE(CHECK_PHASE) };
+
+#ifdef USE_SERVICE_STATS
+typedef struct {
+  uint32_t Calls;
+  uint32_t Events; // calls that returned TRUE
+  uint32_t MaxTicks; // longest call, in core timer ticks
+  uint64_t TotalTicks;
+} CheckStats_t;
+
+static const char * const CheckNames[]={EVENT_CHECK_SCHEDULE(CHECK_NAME) };
+static CheckStats_t CheckStats[ARRAY_SIZE(ES_EventList)];
+#endif
+#endif /* EVENT_CHECK_SCHEDULE */
 
 // Implementation for public functions
 
@@ -38,23 +68,120 @@ static CheckFunc * const ES_EventList[]={EVENT_CHECK_LIST };
    TRUE if any of the user event checkers returned TRUE, FALSE otherwise
  Description
    loop through the EF_EventList array executing the event checking functions
+   that are due
  Notes
-   
+   a checker that is skipped because an earlier one found an event stays
+   due, and is called on the next pass
  Author
    J. Edward Carryer, 10/25/11, 08:55
 ****************************************************************************/
-uint8_t ES_CheckUserEvents( void ) 
+uint8_t ES_CheckUserEvents( void )
 {
+#ifdef EVENT_CHECK_SCHEDULE
   unsigned char i;
+  uint32_t Now = ES_Timer_GetTime();
+  uint32_t Late;
+  uint8_t Found;
+#ifdef USE_SERVICE_STATS
+  uint32_t StartTicks;
+  uint32_t RunTicks;
+#endif
+
   // loop through the array executing the event checking functions
   for ( i=0; i< ARRAY_SIZE(ES_EventList); i++) {
-    if ( ES_EventList[i]() == TRUE )
+    if ( CheckPeriod[i] != 0 ) {
+      if ( (int32_t)(Now - NextDue[i]) < 0 )
+        continue; // not due yet
+      // next due on the phase after now, skipping any periods that were missed
+      Late = Now - NextDue[i];
+      NextDue[i] += CheckPeriod[i] * (Late / CheckPeriod[i] + 1);
+    }
+#ifdef USE_SERVICE_STATS
+    StartTicks = _CP0_GET_COUNT();
+#endif
+    Found = ES_EventList[i]();
+#ifdef USE_SERVICE_STATS
+    RunTicks = _CP0_GET_COUNT() - StartTicks;
+    CheckStats[i].Calls++;
+    CheckStats[i].TotalTicks += RunTicks;
+    if ( RunTicks > CheckStats[i].MaxTicks )
+      CheckStats[i].MaxTicks = RunTicks;
+    if ( Found == TRUE )
+      CheckStats[i].Events++;
+#endif
+    if ( Found == TRUE )
       break; // found a new event, so process it first
   }
   if ( i == ARRAY_SIZE(ES_EventList) ) // if no new events
     return (FALSE);
   else
     return(TRUE);
+#else
+  return (FALSE); // no checkers
+#endif
+}
+
+#if defined(USE_SERVICE_STATS) && defined(EVENT_CHECK_SCHEDULE)
+/****************************************************************************
+ Function
+   ES_ClearCheckerStats
+ Parameters
+   None
+ Returns
+   None
+ Description
+   restarts the call counts and times of the event checkers
+ Notes
+   called by ES_ClearServiceStats
+****************************************************************************/
+void ES_ClearCheckerStats( void )
+{
+  unsigned char i;
+
+  for ( i=0; i< ARRAY_SIZE(ES_EventList); i++) {
+    CheckStats[i].Calls = 0;
+    CheckStats[i].Events = 0;
+    CheckStats[i].MaxTicks = 0;
+    CheckStats[i].TotalTicks = 0;
+  }
+}
+
+/****************************************************************************
+ Function
+   ES_PrintCheckerStats
+ Parameters
+   None
+ Returns
+   None
+ Description
+   prints how often each event checker was called, how many events it found
+   and how long its calls took
+ Notes
+   called by ES_PrintServiceStats, uses printf
+****************************************************************************/
+void ES_PrintCheckerStats( void )
+{
+  unsigned char i;
+  CheckStats_t *pStats;
+
+  printf("checker (period ms): calls events mean/max us\r\n");
+  for ( i=0; i< ARRAY_SIZE(ES_EventList); i++) {
+    pStats = &CheckStats[i];
+    printf("%s (%u): %u %u %u/%u\r\n", CheckNames[i], CheckPeriod[i],
+           pStats->Calls, pStats->Events,
+           pStats->Calls ? (uint32_t)((pStats->TotalTicks / pStats->Calls) / ES_TIMESTAMP_TICKS_PER_US) : 0,
+           pStats->MaxTicks / ES_TIMESTAMP_TICKS_PER_US);
+  }
+}
+#elif defined(USE_SERVICE_STATS)
+// no checkers, so nothing to keep
+void ES_ClearCheckerStats( void )
+{
+}
+
+void ES_PrintCheckerStats( void )
+{
 }
+#endif
 /*------------------------------- Footnotes -------------------------------*/
 /*------------------------------ End of file ------------------------------*/
@@ -24,5 +24,12 @@ typedef CheckFunc (*pCheckFunc);
 
 uint8_t ES_CheckUserEvents( void );
 
+#ifdef USE_SERVICE_STATS
+// call counts and times of the event checkers, cleared and printed along
+// with the service statistics
+void ES_ClearCheckerStats( void );
+void ES_PrintCheckerStats( void );
+#endif
+
 
 #endif  // ES_CheckEvents_H
\ No newline at end of file
@@ -28,6 +28,55 @@
 //uncomment to supress the entry and exit events
 //#define SUPPRESS_EXIT_ENTRY_IN_TATTLE
 
+//define to time every service run function with the core timer, see
+//ES_GetServiceStats() and the BudgetUs entries in SERVICE_LIST
+#define USE_SERVICE_STATS
+
+//uncomment to print the service statistics every so many milliseconds
+//#define SERVICE_STATS_REPORT_PERIOD 5000
+
+//define to idle the core with the wait instruction while all of the queues
+//are empty, instead of spinning through the event checkers. Any interrupt
+//(timer tick, A/D, UART) wakes it up again. With USE_SERVICE_STATS the
+//"wake" line of the report is the time from the timer interrupt to the core
+//running again. The idle current has not been measured.
+#define USE_IDLE_WAIT
+
+//define to drop the fixed 1 ms Timer1 tick and have the core timer compare
+//interrupt fire only when the nearest ES timer is due. ES_Timer_GetTime()
+//is still exact to the millisecond. With USE_IDLE_WAIT nothing then wakes
+//the core for the polled event checkers, so it is only allowed when
+//EVENT_CHECK_SCHEDULE is empty (USE_PERIODIC_TASKS runs them off Timer5).
+//#define USE_TICKLESS_TIMERS
+
+//define to add the 10 us one shot timers on Timer5, see ES_HRTimers.h and
+//the HRTIMERn_RESP_FUNC list below
+#define USE_HR_TIMERS
+
+//define to record how far apart the periodic samples of the bumper and tape
+//services really are, printed with the service statistics, see ES_Histogram.h
+#define USE_PERIOD_HISTOGRAMS
+
+//define to send the ES_LOGn() messages through the deferred log instead of
+//straight to printf, see ES_Log.h. A message is then only its number and
+//arguments in a RAM ring, and the Log service prints it once the UART has
+//emptied, so a sensor path or an interrupt never waits on the serial port
+//and never loses characters to a full transmit buffer.
+#define USE_DEFERRED_LOG
+//The ring holds a whole TattleTale trace.
+#define ES_LOG_RING_SIZE 64 // messages, a power of two up to 128, 24 bytes each
+
+//define to give every ES_Event a 32 bit EventPayload next to EventParam. The
+//tape events use it to carry a snapshot of all of the sensors. This grows an
+//ES_Event from 8 to 12 bytes, which costs 4 bytes per queue entry (140 bytes
+//for the service queues below, 20 for the TopHSM deferral queue).
+#define USE_EVENT_PAYLOAD
+
+//define to stamp every posted ES_Event with the core timer count, so the
+//service statistics and the TattleTale trace show how long events wait
+//before they are handled. Another 4 bytes per queue entry (16 per event).
+#define USE_EVENT_TIMESTAMPS
+
 /****************************************************************************/
 // Name/define the events of interest
 // Universal events occupy the lowest entries, followed by user-defined events
@@ -43,6 +92,9 @@ typedef enum {
     ES_TIMEOUT, /* signals that the timer has expired */
     ES_TIMERACTIVE, /* signals that a timer has become active */
     ES_TIMERSTOPPED, /* signals that a timer has stopped*/
+    ES_HR_TIMEOUT, /* signals that a high resolution timer has expired */
+    ES_TIMEOUT_BATCH, /* several timers expired at once, param is their bitmask */
+    ES_LOG_PENDING, /* the deferred log has records to print */
     NUMBEROFEVENTS,
     /* User-defined events start here */
     BATTERY_CONNECTED,
@@ -73,6 +125,8 @@ typedef enum {
 
 } ES_EventTyp_t;
 
+// every file that includes this gets its own copy, most never use it
+__attribute__((unused))
 static const char *EventNames[] = {
 	"ES_NO_EVENT",
 	"ES_ERROR",
@@ -84,6 +138,9 @@ static const char *EventNames[] = {
 	"ES_TIMEOUT",
 	"ES_TIMERACTIVE",
 	"ES_TIMERSTOPPED",
+	"ES_HR_TIMEOUT",
+	"ES_TIMEOUT_BATCH",
+	"ES_LOG_PENDING",
 	"NUMBEROFEVENTS",
 	"BATTERY_CONNECTED",
 	"BATTERY_DISCONNECTED",
@@ -114,21 +171,134 @@ static const char *EventNames[] = {
 
 
 
+/****************************************************************************/
+// Rings that carry the events posted from interrupt handlers to the service
+// queues, one per interrupt priority level that posts, in the form
+//   ISR_QUEUE(Ipl, Size)
+// where Size is a power of two up to 128. Posts from an ISR running at a level
+// with no ring go straight into the service queue, which is not interrupt
+// safe. Comment out the list to always post straight into the service queues.
+#define ES_ISR_QUEUE_LIST(ISR_QUEUE) \
+    ISR_QUEUE(3, 16) /* Timer1, the ES timers */ \
+    ISR_QUEUE(4, 16) /* Timer5, the high resolution timers and periodic tasks */
+
+/****************************************************************************/
+// Events that are merged with a pending event of the same type instead of
+// taking another queue slot, as COALESCE(event, policy) entries. The policies
+// are ES_COALESCE_DUPLICATE (drop it if the param matches the pending one) and
+// ES_COALESCE_LATEST (only keep the latest param of back to back events of
+// the type). Events not listed are always queued. The tape events are
+// deliberately not listed, the FSMs rely on seeing every TAPE_DETECTED/
+// TAPE_LOST edge in order. The bumper events are not listed either: the
+// FSMs switch on a single bumper bit of BUMPER_PRESSED (ReverseIntoRenState in
+// FSMAttackRen.c only knows one back bumper at a time), so a merged bank with
+// two bumpers in it would match no case and be lost.
+#define ES_COALESCE_LIST(COALESCE) \
+    COALESCE(ES_TIMERACTIVE, ES_COALESCE_DUPLICATE) \
+    COALESCE(ES_TIMERSTOPPED, ES_COALESCE_DUPLICATE) \
+    COALESCE(ES_LOG_PENDING, ES_COALESCE_DUPLICATE)
+
+/****************************************************************************/
+// define to run the fixed rate sampling as a table of periodic tasks, called
+// straight from the high resolution timer interrupt instead of through timer
+// events and service queues, see ES_PeriodicTasks.c. The tick is
+// ES_TASK_TICK high resolution ticks, given by PERIODIC_TASK_HR_TIMER. Each
+// task is listed as PERIODIC_TASK(function, period in task ticks); they are
+// run shortest period first. A task is an event checker style function that
+// runs at interrupt level 4 and posts only when something has changed.
+#define USE_PERIODIC_TASKS
+#define ES_TASK_TICK 30 // 300 us
+#define PERIODIC_TASK_HR_TIMER 1
+#define TAPE_TASK_PERIOD 3 // 900 us, one A/D scan, see tape_detector_fsm_service.c
+#define TRACKWIRE_TASK_PERIOD 3
+#define BUMPER_TASK_PERIOD 10 // 3 ms
+#define ES_PERIODIC_TASK_LIST(PERIODIC_TASK) \
+    PERIODIC_TASK(TapeSensorTask, TAPE_TASK_PERIOD) \
+    PERIODIC_TASK(TrackwireChecker, TRACKWIRE_TASK_PERIOD) \
+    PERIODIC_TASK(CheckBumpers, BUMPER_TASK_PERIOD)
+
+/****************************************************************************/
+// The messages for ES_LOGn(), one entry per message as
+//   LOG_FORMAT(Id, printf format)
+// The Id names the message at the call site, the format is only used when
+// the message is printed. A message takes up to ES_LOG_MAX_ARGS 32 bit
+// arguments (%d, %u, %X, or %s for a string that is never changed or freed),
+// and prints at most ES_LOG_MAX_CHARS characters.
+#define ES_LOG_FORMAT_LIST(LOG_FORMAT) \
+    LOG_FORMAT(LOG_DROPPED, "log: %u messages dropped\r\n") \
+    LOG_FORMAT(LOG_OVER_BUDGET, "%s over budget: %u us\r\n") \
+    LOG_FORMAT(LOG_EVENT, "%s %X\r\n") \
+    LOG_FORMAT(LOG_TATTLE_START, "\r\n") \
+    LOG_FORMAT(LOG_TATTLE_STEP, "%s(%s[%s,%X])@%uus->") \
+    LOG_FORMAT(LOG_TATTLE_LAST, "%s(%s[%s,%X])@%uus;") \
+    LOG_FORMAT(LOG_TATTLE_POSTED, " posted %uus before") \
+    LOG_FORMAT(LOG_TATTLE_END, "\n") \
+    LOG_FORMAT(LOG_ON_T, "On T!!!\r\n") \
+    LOG_FORMAT(LOG_GO_TO_FIND_LINE, "GO_TO_FIND_LINE\r\n") \
+    LOG_FORMAT(LOG_GO_TO_ON_LINE, "GO_TO_ON_LINE\r\n") \
+    LOG_FORMAT(LOG_UNSTUCK_FRONT, "Unstuck_state, front bumpers pressed reach if ---------->\r\n") \
+    LOG_FORMAT(LOG_UNSTUCK_ELSE, "Unstuck_state, reach else ---------->\r\n") \
+    LOG_FORMAT(LOG_PWM_ALL, "PWM_ALL-------------------> %d\r\n") \
+    LOG_FORMAT(LOG_TAPE_PIN, "Pin:%d done\r\n") \
+    LOG_FORMAT(LOG_ALIGN_ATM6, "****************************** FSMAlignATM6\r\n") \
+    LOG_FORMAT(LOG_REN_TAPE, "REACHED TAPE DETECTED ------------------------------ \r\n" \
+        "Front = %d\r\nLEft = %d\r\nRight = %d\r\nCenter = %d\r\nBack = %d\r\n" \
+        "REACHED TAPE DETECTED ------------------------------ \r\n") \
+    LOG_FORMAT(LOG_ON_T_COUNTER, "is_on_T: %d, get_atm6_counter: %d\r\n") \
+    LOG_FORMAT(LOG_STOP9_TIMER, "TIMER_STARTED on Stop 9\r\n") \
+    LOG_FORMAT(LOG_NOT_ON_T, "reach else if is_on_T() == FALSE\r\n") \
+    LOG_FORMAT(LOG_ON_T_ELSE, "WTF!!!!!!!!!!\r\n") \
+    LOG_FORMAT(LOG_ATM6_DOWN, "\r\nATM6 DOWN2!!!!!!!,--------------------> counter= %d\r\n") \
+    LOG_FORMAT(LOG_ATM6_UP, "\r\nATM6 Still UP!!!!!!!, ------------------> counter= %d\r\n") \
+    LOG_FORMAT(LOG_SHOOTER_FAST, "startMotorFast, first_time --------> %d\r\n") \
+    LOG_FORMAT(LOG_FIND_LINE_FRONT, "In FSM_find_line.c, turnRightState->ES_ENTRY->FRONT_TAPE_DECTECTED\r\n") \
+    LOG_FORMAT(LOG_MINI_AVOID_TIME, "\r\nTIME IS:%d -------->>\r\n") \
+    LOG_FORMAT(LOG_DEFER_FULL, "TopHSM: deferral queue full, event dropped\r\n") \
+    LOG_FORMAT(LOG_BEACON_LATENCY, "beacon latency us: post max %u, handled mean/max %u/%u over %u events\r\n")
+
 /****************************************************************************/
 // This are the name of the Event checking function header file.
 #define EVENT_CHECK_HEADER "event_checker.h"
 
 /****************************************************************************/
-// This is the list of event checking functions
-#define EVENT_CHECK_LIST  TrackwireChecker,BeaconDetectorChecker
+// This is the list of event checking functions, as
+//   EVENT_CHECKER(function, period, phase)
+// with the period and phase in ms. A checker is only called from the idle
+// loop when it is due: at phase ms, then every period ms after that. Two
+// checkers only stay off each other's passes when the difference of their
+// phases is not a multiple of the greatest common divisor of their periods:
+// 2 ms at phase 1 and 4 ms at phase 0 interleave, but 2 ms at phase 1 and
+// 5 ms at phase 0 both fall due at 5, 15, 25... ms. A period of 0 calls it
+// on every pass of the idle loop.
+// Leave EVENT_CHECK_SCHEDULE undefined when there are no checkers. The
+// trackwire readings change every A/D scan (0.86 ms) and are checked every
+// 2 ms; with the periodic tasks TrackwireChecker is a task instead. The
+// beacon is not polled at all, see beacon_detector.c.
+#ifndef USE_PERIODIC_TASKS
+#define EVENT_CHECK_SCHEDULE(EVENT_CHECKER) \
+    EVENT_CHECKER(TrackwireChecker, 2, 0)
+// the plain list of the functions, for the event checker test harness
+#define EVENT_CHECK_NAME(Func, Period, Phase) Func,
+#define EVENT_CHECK_LIST EVENT_CHECK_SCHEDULE(EVENT_CHECK_NAME)
+#endif
 
 /****************************************************************************/
 // These are the definitions for the post functions to be executed when the
-// corresponding timer expires. All 16 must be defined. If you are not using
-// a timers, then you can use TIMER_UNUSED
+// corresponding timer expires. All 32 must be defined. If you are not using
+// a timers, then you can use TIMER_UNUSED. Timers set to TIMER_POOL are
+// not used by number, ES_Timer_StartPooled hands them out at run time.
 #define TIMER_UNUSED ((pPostFunc)0)
+#define TIMER_POOL PostPooledTimer
+#if defined(USE_PERIODIC_TASKS) || defined(USE_HR_TIMERS)
+#define TIMER0_RESP_FUNC TIMER_UNUSED // the tape is paced by a task or HR timer 0
+#else
 #define TIMER0_RESP_FUNC PostTapeDetectorFSMService
+#endif
+#ifdef USE_PERIODIC_TASKS
+#define TIMER1_RESP_FUNC TIMER_UNUSED // the bumper sampling is a task
+#else
 #define TIMER1_RESP_FUNC PostBumperService
+#endif
 #define TIMER2_RESP_FUNC PostTopHSM
 #define TIMER3_RESP_FUNC PostTopHSM
 #define TIMER4_RESP_FUNC PostTopHSM
@@ -138,11 +308,27 @@ static const char *EventNames[] = {
 #define TIMER8_RESP_FUNC PostTopHSM
 #define TIMER9_RESP_FUNC PostTopHSM
 #define TIMER10_RESP_FUNC PostTopHSM
-#define TIMER11_RESP_FUNC PostTopHSM
+#define TIMER11_RESP_FUNC TIMER_UNUSED
 #define TIMER12_RESP_FUNC PostTopHSM
 #define TIMER13_RESP_FUNC PostTopHSM
 #define TIMER14_RESP_FUNC PostTopHSM
-#define TIMER15_RESP_FUNC TIMER_UNUSED
+#define TIMER15_RESP_FUNC PostLogService
+#define TIMER16_RESP_FUNC TIMER_POOL
+#define TIMER17_RESP_FUNC TIMER_POOL
+#define TIMER18_RESP_FUNC TIMER_POOL
+#define TIMER19_RESP_FUNC TIMER_POOL
+#define TIMER20_RESP_FUNC TIMER_POOL
+#define TIMER21_RESP_FUNC TIMER_POOL
+#define TIMER22_RESP_FUNC TIMER_POOL
+#define TIMER23_RESP_FUNC TIMER_POOL
+#define TIMER24_RESP_FUNC TIMER_POOL
+#define TIMER25_RESP_FUNC TIMER_POOL
+#define TIMER26_RESP_FUNC TIMER_POOL
+#define TIMER27_RESP_FUNC TIMER_POOL
+#define TIMER28_RESP_FUNC TIMER_POOL
+#define TIMER29_RESP_FUNC TIMER_POOL
+#define TIMER30_RESP_FUNC TIMER_POOL
+#define TIMER31_RESP_FUNC TIMER_POOL
 
 
 /****************************************************************************/
@@ -151,7 +337,7 @@ static const char *EventNames[] = {
 // definitions for the response functions to make it easire to check that
 // the timer number matches where the timer event will be routed
 
-#define TAPE_SENSOR_TIMER 0 /*make sure this is enabled above and posting to the correct state machine*/
+#define TAPE_SENSOR_TIMER 0 /* only without USE_HR_TIMERS, TAPE_SENSOR_HR_TIMER otherwise */
 #define BUMPER_SENSOR_TIMER 1 /*make sure this is enabled above and posting to the correct state machine*/
 #define TAPE_FOLLOWER_TIMER 2
 #define COLLISION_AVOIDANCE_TIMER 3
@@ -162,129 +348,127 @@ static const char *EventNames[] = {
 #define MINI_AVOID_TIMER 8
 #define EXIT_SHOOTER_TIMER 9
 #define ATTACK_REN_TIMER 10
-#define START_WAR_TIMER 11
 #define UNSTUCK_TIMER 12
 #define OH_SHIT_TIMER 13
 #define RESET_BUMPER_COUNTER_TIMER 14
-
+#define LOG_TIMER 15
 
 /****************************************************************************/
-// The maximum number of services sets an upper bound on the number of 
-// services that the framework will handle. Reasonable values are 8 and 16
-// HOWEVER: at this time only a value of 8 is supported.
-#define MAX_NUM_SERVICES 8
+// The post functions for the high resolution timers, as for the timers above,
+// and the names of the ones in use
+#define NUM_HR_TIMERS 4
+#ifdef USE_PERIODIC_TASKS
+#define HRTIMER0_RESP_FUNC TIMER_UNUSED
+#define HRTIMER1_RESP_FUNC ES_PeriodicTask_Run // PERIODIC_TASK_HR_TIMER
+#else
+#define HRTIMER0_RESP_FUNC PostTapeDetectorFSMService
+#define HRTIMER1_RESP_FUNC TIMER_UNUSED
+#endif
+#define HRTIMER2_RESP_FUNC BeaconPulseConfirmed
+#define HRTIMER3_RESP_FUNC TIMER_UNUSED
 
-/****************************************************************************/
-// This macro determines that nuber of services that are *actually* used in
-// a particular application. It will vary in value from 1 to MAX_NUM_SERVICES
-#define NUM_SERVICES 3
+#define TAPE_SENSOR_HR_TIMER 0
+#define BEACON_HR_TIMER 2 // glitch filter for the beacon edges
 
 /****************************************************************************/
-// These are the definitions for Service 0, the lowest priority service
-// every Events and Services application must have a Service 0. Further 
-// services are added in numeric sequence (1,2,3,...) with increasing 
-// priorities
-// the header file with the public fuction prototypes
-#define SERV_0_HEADER "tape_detector_fsm_service.h"
-// the name of the Init function
-#define SERV_0_INIT InitTapeDetectorFSMService
-// the name of the run function
-#define SERV_0_RUN RunTapeDetectorFSMService
-// How big should this service's Queue be?
-#define SERV_0_QUEUE_SIZE 9
+// Bit mask of the timers that still post ES_TIMERACTIVE/ES_TIMERSTOPPED to
+// their service when they are started or stopped, bit n for timer n. None of
+// the state machines act on these events, so they are all off. Use e.g.
+// (1 << TOP_HSM_TIMER) to turn them back on for a single timer.
+#define TIMER_NOTIFY_MASK 0
 
 /****************************************************************************/
-// These are the definitions for Service 1
-#if NUM_SERVICES > 1
-// the header file with the public fuction prototypes
-#define SERV_1_HEADER "bumper_service.h"
-// the name of the Init function
-#define SERV_1_INIT InitBumperService
-// the name of the run function
-#define SERV_1_RUN RunBumperService
-// How big should this services Queue be?
-#define SERV_1_QUEUE_SIZE 9
-#endif
-
-// These are the definitions for Service 2
-#if NUM_SERVICES > 2
-// the header file with the public fuction prototypes
-#define SERV_2_HEADER "TopHSM.h"
-// the name of the Init function
-#define SERV_2_INIT InitTopHSM
-// the name of the run function
-#define SERV_2_RUN RunTopHSM
-// How big should this services Queue be?
-#define SERV_2_QUEUE_SIZE 9
-#endif
-
+// define to post one ES_TIMEOUT_BATCH to a service when more than one of its
+// timers expires in the same timer interrupt, with bit n of EventParam set
+// for timer n, instead of one ES_TIMEOUT each. A lone expiry is still posted
+// as an ES_TIMEOUT. Only timers 0 to 15 fit in the mask, higher numbered
+// timers and the pooled timers are always posted on their own. Every service
+// that owns more than one timer (only TopHSM here) must handle the batch.
+#define BATCH_TIMEOUT_EVENTS
 
 
 /****************************************************************************/
-// These are the definitions for Service 3
-#if NUM_SERVICES > 3
-// the header file with the public fuction prototypes
-#define SERV_3_HEADER "TestService.h"
-// the name of the Init function
-#define SERV_3_INIT TestServiceInit
-// the name of the run function
-#define SERV_3_RUN TestServiceRun
-// How big should this services Queue be?
-#define SERV_3_QUEUE_SIZE 9
-#endif
+// The maximum number of services sets an upper bound on the number of 
+// services that the framework will handle. The Ready mask is 32 bits wide,
+// so up to 32 services are supported.
+#define MAX_NUM_SERVICES 32
 
 /****************************************************************************/
-// These are the definitions for Service 4
-#if NUM_SERVICES > 4
-// the header file with the public fuction prototypes
-#define SERV_4_HEADER "TestService.h"
-// the name of the Init function
-#define SERV_4_INIT TestServiceInit
-// the name of the run function
-#define SERV_4_RUN TestServiceRun
-// How big should this services Queue be?
-#define SERV_4_QUEUE_SIZE 3
+// This is the list of services used in this application, one entry per
+// service in the form
+//   SERVICE(Name, InitFunction, RunFunction, QueueSize, BudgetUs)
+// The first entry is Service 0, the lowest priority service. Every Events and
+// Services application must have a Service 0. Further services follow in
+// increasing order of priority. The framework builds its service table and
+// one statically allocated queue of QueueSize events per service from this
+// list, and SERV_<Name> is the index (and priority) of each service.
+// QueueSize must be a power of two so that the queue can wrap with a mask,
+// any other size fails to compile.
+// BudgetUs is the longest a single call to the run function should take, in
+// microseconds, with 0 for no budget. Runs over budget are counted and logged
+// when USE_SERVICE_STATS is defined.
+// The header files with the public function prototypes for these services
+// are included in ES_ServiceHeaders.h, one per entry in the same order. When
+// an entry is added or removed here, make the same change there.
+// With USE_PERIODIC_TASKS the tape state machine and the bumper debounce are
+// only ever run from their tasks, so they are not services and have no
+// queue that a post could reach.
+#ifdef USE_PERIODIC_TASKS
+#define TAPE_DETECTOR_SERVICE(SERVICE)
+#define BUMPER_SERVICE(SERVICE)
+#else
+#define TAPE_DETECTOR_SERVICE(SERVICE) \
+    SERVICE(TapeDetector, InitTapeDetectorFSMService, RunTapeDetectorFSMService, 8, 200)
+#define BUMPER_SERVICE(SERVICE) \
+    SERVICE(Bumper, InitBumperService, RunBumperService, 8, 200)
 #endif
 
-/****************************************************************************/
-// These are the definitions for Service 5
-#if NUM_SERVICES > 5
-// the header file with the public fuction prototypes
-#define SERV_5_HEADER "TestService.h"
-// the name of the Init function
-#define SERV_5_INIT TestServiceInit
-// the name of the run function
-#define SERV_5_RUN TestServiceRun
-// How big should this services Queue be?
-#define SERV_5_QUEUE_SIZE 3
-#endif
+#define SERVICE_LIST(SERVICE) \
+    SERVICE(Log, InitLogService, RunLogService, 4, 1000) \
+    TAPE_DETECTOR_SERVICE(SERVICE) \
+    BUMPER_SERVICE(SERVICE) \
+    SERVICE(TopHSM, InitTopHSM, RunTopHSM, 16, 1000)
 
 /****************************************************************************/
-// These are the definitions for Service 6
-#if NUM_SERVICES > 6
-// the header file with the public fuction prototypes
-#define SERV_6_HEADER "TestService.h"
-// the name of the Init function
-#define SERV_6_INIT TestServiceInit
-// the name of the run function
-#define SERV_6_RUN TestServiceRun
-// How big should this services Queue be?
-#define SERV_6_QUEUE_SIZE 3
-#endif
+// This determines the number of services that are *actually* used in
+// a particular application, it is generated from SERVICE_LIST above
+#define SERVICE_INDEX(Name, InitFunc, RunFunc, QueueSize, BudgetUs) SERV_##Name,
+
+enum {
+    SERVICE_LIST(SERVICE_INDEX)
+    NUM_SERVICES
+};
 
 /****************************************************************************/
-// These are the definitions for Service 7
-#if NUM_SERVICES > 7
-// the header file with the public fuction prototypes
-#define SERV_7_HEADER "TestService.h"
-// the name of the Init function
-#define SERV_7_INIT TestServiceInit
-// the name of the run function
-#define SERV_7_RUN TestServiceRun
-// How big should this services Queue be?
-#define SERV_7_QUEUE_SIZE 3
+// Who gets the events sent with ES_Publish(), one entry per event type as
+//   PUBLISH(Event, Subscribers)
+// where Subscribers is ES_SUBSCRIBER(Name) for each service in SERVICE_LIST
+// that wants the event, or'd together. The sensors publish instead of
+// posting to a state machine by name, so another service can listen to
+// them by being added here. Event types not listed are not published.
+// Define LOG_SENSOR_EVENTS to have the Log service print every sensor event.
+#define ES_SUBSCRIBER(Name) (1UL << SERV_##Name)
+
+//#define LOG_SENSOR_EVENTS
+#ifdef LOG_SENSOR_EVENTS
+#define SENSOR_SUBSCRIBERS (ES_SUBSCRIBER(TopHSM) | ES_SUBSCRIBER(Log))
+#else
+#define SENSOR_SUBSCRIBERS ES_SUBSCRIBER(TopHSM)
 #endif
 
+#define ES_SUBSCRIPTION_LIST(PUBLISH) \
+    PUBLISH(TAPE_DETECTED, SENSOR_SUBSCRIBERS) \
+    PUBLISH(TAPE_LOST, SENSOR_SUBSCRIBERS) \
+    PUBLISH(BUMPER_PRESSED, SENSOR_SUBSCRIBERS) \
+    PUBLISH(BUMPER_RELEASED, SENSOR_SUBSCRIBERS) \
+    PUBLISH(REN_BUMPER_PRESSED, SENSOR_SUBSCRIBERS) \
+    PUBLISH(REN_BUMPER_RELEASE, SENSOR_SUBSCRIBERS) \
+    PUBLISH(TRACKWIRE_LOST, SENSOR_SUBSCRIBERS) \
+    PUBLISH(TRACKWIRE_ALIGNED, SENSOR_SUBSCRIBERS) \
+    PUBLISH(TRACKWIRE_DETECTED, SENSOR_SUBSCRIBERS) \
+    PUBLISH(BEACON_LOST, SENSOR_SUBSCRIBERS) \
+    PUBLISH(BEACON_FOUND, SENSOR_SUBSCRIBERS)
+
 /****************************************************************************/
 // the name of the posting function that you want executed when a new 
 // keystroke is detected.
@@ -293,36 +477,4 @@ static const char *EventNames[] = {
 
 
 
-/****************************************************************************/
-// These are the definitions for the Distribution lists. Each definition
-// should be a comma seperated list of post functions to indicate which
-// services are on that distribution list.
-#define NUM_DIST_LISTS 0
-#if NUM_DIST_LISTS > 0 
-#define DIST_LIST0 PostTemplateFSM
-#endif
-#if NUM_DIST_LISTS > 1 
-#define DIST_LIST1 PostTemplateFSM
-#endif
-#if NUM_DIST_LISTS > 2 
-#define DIST_LIST2 PostTemplateFSM
-#endif
-#if NUM_DIST_LISTS > 3 
-#define DIST_LIST3 PostTemplateFSM
-#endif
-#if NUM_DIST_LISTS > 4 
-#define DIST_LIST4 PostTemplateFSM
-#endif
-#if NUM_DIST_LISTS > 5 
-#define DIST_LIST5 PostTemplateFSM
-#endif
-#if NUM_DIST_LISTS > 6 
-#define DIST_LIST6 PostTemplateFSM
-#endif
-#if NUM_DIST_LISTS > 7 
-#define DIST_LIST7 PostTemplateFSM
-#endif
-
-
-
 #endif /* CONFIGURE_H */
\ No newline at end of file
@@ -23,6 +23,12 @@
 typedef struct ES_Event_t {
     ES_EventTyp_t EventType;    // what kind of event?
     uint16_t   EventParam;      // parameter value for use w/ this event
+#ifdef USE_EVENT_PAYLOAD
+    uint32_t   EventPayload;    // wider value, only set by events that say so
+#endif
+#ifdef USE_EVENT_TIMESTAMPS
+    uint32_t   EventTime;       // core timer count when posted, set by ES_PostToService
+#endif
 }ES_Event;
 
 #define INIT_EVENT  (ES_Event){ES_INIT,0x0000}
@@ -30,4 +36,9 @@ typedef struct ES_Event_t {
 #define EXIT_EVENT  (ES_Event){ES_EXIT,0x0000}
 #define NO_EVENT (ES_Event){ES_NO_EVENT,0x0000}
 
+// the form of every post function, for the timer and hysteresis tables
+typedef uint8_t PostFunc_t( ES_Event );
+
+typedef PostFunc_t (*pPostFunc);
+
 #endif /* ES_Events_H */
@@ -17,14 +17,16 @@
 /*----------------------------- Include Files -----------------------------*/
 #include "ES_Configure.h"
 #include "ES_Queue.h"
-#include "ES_PostList.h"
+#include "ES_ISRQueue.h"
 #include "ES_CheckEvents.h"
 #include "ES_LookupTables.h"
 #include "ES_Timers.h"
 #include "ES_Framework.h"
 #include "ES_KeyboardInput.h"
 #include "ES_Events.h"
+#include "ES_Log.h"
 #include <stdio.h>
+#include <xc.h>
 #include <BOARD.h>
 //#include <termio.h>
 
@@ -54,50 +56,78 @@ typedef struct {
     uint8_t Size; // how big is it
 } ES_QueueDesc_t;
 
+
+typedef struct {
+    uint32_t Events; // number of calls to the run function
+    uint32_t MinTicks; // shortest run, in core timer ticks
+    uint32_t MaxTicks; // longest run, in core timer ticks
+    uint64_t TotalTicks; // time spent in the run function, in core timer ticks
+    uint32_t Overruns; // number of runs that took longer than the budget
+#ifdef USE_EVENT_TIMESTAMPS
+    uint32_t MaxLatencyTicks; // longest wait from post to run
+    uint64_t TotalLatencyTicks;
+#endif
+} ES_RunStats_t;
+
 /*---------------------------- Module Functions ---------------------------*/
 static uint8_t CheckSystemEvents(void);
+static uint8_t PostToQueue(uint8_t WhichQueue, ES_Event TheEvent);
+static uint8_t PublishToQueues(uint32_t Subscribers, ES_Event TheEvent);
+static uint32_t GetSubscribers(ES_EventTyp_t EventType);
+#ifdef ES_ISR_QUEUE_LIST
+static void DrainISRQueues(void);
+static uint8_t AreISRQueuesEmpty(void);
+#endif
+#ifdef USE_SERVICE_STATS
+static void UpdateServiceStats(uint8_t WhichService, uint32_t RunTicks);
+#ifdef USE_EVENT_TIMESTAMPS
+static void UpdateLatencyStats(uint8_t WhichService, uint32_t LatencyTicks);
+#endif
+#endif
+#ifdef USE_IDLE_WAIT
+static void IdleUntilInterrupt(void);
+#endif
 
 /*---------------------------- Module Variables ---------------------------*/
 /****************************************************************************/
-// You fill in this array with the names of the service init & run functions
-// for each service that you use.
-// The order is: InitFunction, RunFunction
-// The first enry, at index 0, is the lowest priority, with increasing 
+// The service init & run functions for each service in SERVICE_LIST.
+// The first entry, at index 0, is the lowest priority, with increasing 
 // priority with higher indices
 
+#define SERVICE_DESC(Name, InitFunc, RunFunc, QueueSize, BudgetUs) {InitFunc, RunFunc},
+
 static ES_ServDesc_t const ServDescList[] = {
-    {SERV_0_INIT, SERV_0_RUN} /* lowest priority  always present */
-#if NUM_SERVICES > 1
-    ,
-    {SERV_1_INIT, SERV_1_RUN}
-#endif
-#if NUM_SERVICES > 2
-    ,
-    {SERV_2_INIT, SERV_2_RUN}
-#endif
-#if NUM_SERVICES > 3
-    ,
-    {SERV_3_INIT, SERV_3_RUN}
-#endif
-#if NUM_SERVICES > 4
-    ,
-    {SERV_4_INIT, SERV_4_RUN}
-#endif
-#if NUM_SERVICES > 5
-    ,
-    {SERV_5_INIT, SERV_5_RUN}
-#endif
-#if NUM_SERVICES > 6
-    ,
-    {SERV_6_INIT, SERV_6_RUN}
-#endif
-#if NUM_SERVICES > 7
-    ,
-    {SERV_7_INIT, SERV_7_RUN}
-#endif
+    SERVICE_LIST(SERVICE_DESC)
+};
+
+// Ready is a 32 bit mask, one bit per service
+typedef char ServiceCountCheck[(NUM_SERVICES <= MAX_NUM_SERVICES) ? 1 : -1];
+
+#ifdef USE_SERVICE_STATS
+/****************************************************************************/
+// names and run time budgets of the services, for the statistics
+
+#define SERVICE_NAME(Name, InitFunc, RunFunc, QueueSize, BudgetUs) #Name,
 
+static const char * const ServiceNames[] = {
+    SERVICE_LIST(SERVICE_NAME)
 };
 
+#define SERVICE_BUDGET(Name, InitFunc, RunFunc, QueueSize, BudgetUs) \
+    (BudgetUs) * ES_TIMESTAMP_TICKS_PER_US,
+
+static uint32_t const ServiceBudget[] = {
+    SERVICE_LIST(SERVICE_BUDGET)
+};
+
+static ES_RunStats_t RunStats[NUM_SERVICES];
+#ifdef USE_IDLE_WAIT
+static ES_RunStats_t IdleStats;
+static ES_RunStats_t WakeStats; // timer interrupt to the end of the wait
+#endif
+static uint32_t StatsStartTime; // ES timer time of the last clear
+#endif
+
 /****************************************************************************/
 // Initialize this variable with the name of the posting function that you
 // want executed when a new keystroke is detected.
@@ -107,68 +137,82 @@ static pPostFunc const pPostKeyFunc = POST_KEY_FUNC;
 /****************************************************************************/
 // The queues for the services
 
-static ES_Event Queue0[SERV_0_QUEUE_SIZE + 1];
-#if NUM_SERVICES > 1
-static ES_Event Queue1[SERV_1_QUEUE_SIZE + 1];
-#endif
-#if NUM_SERVICES > 2
-static ES_Event Queue2[SERV_2_QUEUE_SIZE + 1];
-#endif
-#if NUM_SERVICES > 3
-static ES_Event Queue3[SERV_3_QUEUE_SIZE + 1];
-#endif
-#if NUM_SERVICES > 4
-static ES_Event Queue4[SERV_4_QUEUE_SIZE + 1];
-#endif
-#if NUM_SERVICES > 5
-static ES_Event Queue5[SERV_5_QUEUE_SIZE + 1];
-#endif
-#if NUM_SERVICES > 6
-static ES_Event Queue6[SERV_6_QUEUE_SIZE + 1];
-#endif
-#if NUM_SERVICES > 7
-static ES_Event Queue7[SERV_7_QUEUE_SIZE + 1];
-#endif
+#define SERVICE_QUEUE(Name, InitFunc, RunFunc, QueueSize, BudgetUs) \
+    ES_QUEUE_SIZE_CHECK(Queue##Name, QueueSize); \
+    static ES_Event Queue##Name[QueueSize + 1];
+
+SERVICE_LIST(SERVICE_QUEUE)
 
 /****************************************************************************/
 // array of queue descriptors for posting by priority level
 
+#define SERVICE_QUEUE_DESC(Name, InitFunc, RunFunc, QueueSize, BudgetUs) \
+    {Queue##Name, ARRAY_SIZE(Queue##Name)},
+
 static ES_QueueDesc_t const EventQueues[NUM_SERVICES] = {
-    { Queue0, ARRAY_SIZE(Queue0)}
-#if NUM_SERVICES > 1
-    ,
-    { Queue1, ARRAY_SIZE(Queue1)}
-#endif
-#if NUM_SERVICES > 2
-    ,
-    { Queue2, ARRAY_SIZE(Queue2)}
-#endif
-#if NUM_SERVICES > 3
-    ,
-    { Queue3, ARRAY_SIZE(Queue3)}
-#endif
-#if NUM_SERVICES > 4
-    ,
-    { Queue4, ARRAY_SIZE(Queue4)}
-#endif
-#if NUM_SERVICES > 5
-    ,
-    { Queue5, ARRAY_SIZE(Queue5)}
-#endif
-#if NUM_SERVICES > 6
-    ,
-    { Queue6, ARRAY_SIZE(Queue6)}
-#endif
-#if NUM_SERVICES > 7
-    ,
-    { Queue7, ARRAY_SIZE(Queue7)}
+    SERVICE_LIST(SERVICE_QUEUE_DESC)
+};
+
+/****************************************************************************/
+// coalescing policy for each event type, indexed by event type. Types past
+// the end of the table (and any not listed) are ES_COALESCE_NONE.
+#define COALESCE_POLICY(Event, Policy) [Event] = Policy,
+
+static uint8_t const CoalescePolicy[] = {
+    [ES_NO_EVENT] = ES_COALESCE_NONE,
+    ES_COALESCE_LIST(COALESCE_POLICY)
+};
+
+// overflow and coalesce counters for each queue
+static ES_QueueStats_t QueueStats[NUM_SERVICES];
+
+/****************************************************************************/
+// the services that ES_Publish posts each event type to, bit n for service n,
+// indexed by event type. Types past the end of the table (and any not
+// listed) have no subscribers.
+#define SUBSCRIPTION_MASK(Event, Subscribers) [Event] = (Subscribers),
+
+static uint32_t const SubscriberMask[] = {
+    [ES_NO_EVENT] = 0,
+#ifdef ES_SUBSCRIPTION_LIST
+    ES_SUBSCRIPTION_LIST(SUBSCRIPTION_MASK)
 #endif
 };
 
+/****************************************************************************/
+// the rings that ISRs post into, see ES_ISR_QUEUE_LIST
+#ifdef ES_ISR_QUEUE_LIST
+#define MAX_IPL 7
+
+// the service number in a ring entry that is published, not posted
+#define ISR_PUBLISH 0xFF
+typedef char ISRPublishCheck[(NUM_SERVICES <= ISR_PUBLISH) ? 1 : -1];
+
+#define ISR_QUEUE_STORAGE(Ipl, Size) \
+    static ES_ISRQueueEntry_t ISRQueueEntries##Ipl[Size]; \
+    static ES_ISRQueue_t ISRQueue##Ipl;
+#define ISR_QUEUE_BY_IPL(Ipl, Size) [Ipl] = &ISRQueue##Ipl,
+#define ISR_QUEUE_ENTRY(Ipl, Size) &ISRQueue##Ipl,
+#define ISR_QUEUE_INIT(Ipl, Size) \
+    if (ES_ISRQueue_Init(&ISRQueue##Ipl, ISRQueueEntries##Ipl, Size) != TRUE) \
+        return FailedInit;
+
+ES_ISR_QUEUE_LIST(ISR_QUEUE_STORAGE)
+
+// the ring for each interrupt priority level, NULL where there is none
+static ES_ISRQueue_t * const ISRQueueByIPL[MAX_IPL + 1] = {
+    ES_ISR_QUEUE_LIST(ISR_QUEUE_BY_IPL)
+};
+
+static ES_ISRQueue_t * const ISRQueues[] = {
+    ES_ISR_QUEUE_LIST(ISR_QUEUE_ENTRY)
+};
+#endif
+
 /****************************************************************************/
 // Variable used to keep track of which queues have events in them
 
-uint8_t Ready;
+volatile uint32_t Ready;
 
 /*------------------------------ Module Code ------------------------------*/
 
@@ -189,7 +233,14 @@ uint8_t Ready;
  ****************************************************************************/
 ES_Return_t ES_Initialize(void) {
     unsigned char i;
+#ifdef ES_ISR_QUEUE_LIST
+    // the rings must be ready before the first timer interrupt posts
+    ES_ISR_QUEUE_LIST(ISR_QUEUE_INIT)
+#endif
     ES_Timer_Init(); // start up the timer subsystem
+#ifdef USE_HR_TIMERS
+    ES_HRTimer_Init();
+#endif
     // loop through the list testing for NULL pointers and
     for (i = 0; i < ARRAY_SIZE(ServDescList); i++) {
         if ((ServDescList[i].InitFunc == (pInitFunc) 0) ||
@@ -201,6 +252,14 @@ ES_Return_t ES_Initialize(void) {
         if (ServDescList[i].InitFunc(i) != TRUE)
             return FailedInit; // this is a failed initialization
     }
+#ifdef USE_PERIODIC_TASKS
+    // after the services, the tasks work on the state they set up
+    if (ES_PeriodicTask_Init() != TRUE)
+        return FailedInit;
+#endif
+#ifdef USE_SERVICE_STATS
+    ES_ClearServiceStats();
+#endif
     return Success;
 }
 
@@ -213,9 +272,10 @@ ES_Return_t ES_Initialize(void) {
  Returns
    ES_Return_t : FailedRun is any of the run functions failed during execution
  Description
-   This is the main framework function. It searches through the state
-   machines to find one with a non-empty queue and then executes the
-   state machine to process the event in its queue.
+   This is the main framework function. It picks the highest priority
+   state machine with a non-empty queue straight from the Ready mask and
+   executes it to process one event from its queue. Priorities are
+   re-evaluated after every event.
    while all the queues are empty, it searches for system generated or
    user generated events.
  Notes
@@ -228,38 +288,60 @@ ES_Return_t ES_Run(void) {
     // make these static to improve speed
     uint8_t HighestPrior;
     static ES_Event ThisEvent;
-    uint8_t CurService;
-    uint8_t CurServiceMask;
+    static ES_Event ReturnEvent;
+#ifdef USE_SERVICE_STATS
+    uint32_t RunStart;
+#ifdef SERVICE_STATS_REPORT_PERIOD
+    uint32_t LastReport = ES_Timer_GetTime();
+#endif
+#endif
 
     while (1) { // stay here unless we detect an error condition
 
-        // loop through the list executing the run functions for services
-        // with a non-empty queue
+#ifdef ES_ISR_QUEUE_LIST
+        DrainISRQueues(); // move anything posted from an ISR to its queue
+#endif
+        // run the highest priority service with a non-empty queue, one event
+        // at a time, so that a newly posted event to a higher priority service
+        // is always handled before the next event of a lower priority one
         while (Ready != 0) {
-            //if (IsTransmitEmpty()) {
-                 //printf("handling queues: %X\r\n", Ready);
-            //}
-            for (CurService = 0; CurService < NUM_SERVICES; CurService++) {
-                CurServiceMask = 1 << CurService;
-                //printf("handling queue: %X: %X: %X\r\n", CurService,Ready,Ready & CurServiceMask);
-                if (Ready & CurServiceMask) {
-                    if (ES_DeQueue(EventQueues[CurService].pMem, &ThisEvent) == 0) {
-                        Ready &= ~CurServiceMask; // mark queue as now empty
-                    }
-                    if (ServDescList[CurService].RunFunc(ThisEvent).EventType == ES_ERROR) {
-                        return FailedRun;
-                    }
-                }
+            HighestPrior = ES_GetMSBitNum(Ready);
+            if (ES_DeQueue(EventQueues[HighestPrior].pMem, &ThisEvent) == 0) {
+                Ready &= ~(1UL << HighestPrior); // mark queue as now empty
             }
+#ifdef USE_SERVICE_STATS
+            RunStart = _CP0_GET_COUNT();
+#endif
+            ReturnEvent = ServDescList[HighestPrior].RunFunc(ThisEvent);
+#ifdef USE_SERVICE_STATS
+            UpdateServiceStats(HighestPrior, _CP0_GET_COUNT() - RunStart);
+#ifdef USE_EVENT_TIMESTAMPS
+            UpdateLatencyStats(HighestPrior, RunStart - ThisEvent.EventTime);
+#endif
+#endif
+            if (ReturnEvent.EventType == ES_ERROR) {
+                return FailedRun;
+            }
+#ifdef ES_ISR_QUEUE_LIST
+            DrainISRQueues();
+#endif
         }
+#ifdef SERVICE_STATS_REPORT_PERIOD
+        if ((ES_Timer_GetTime() - LastReport) >= SERVICE_STATS_REPORT_PERIOD) {
+            LastReport = ES_Timer_GetTime();
+            ES_PrintServiceStats();
+        }
+#endif
         // all the queues are empty, so look for new system or user detected events
-        if (CheckSystemEvents() == FALSE)
+        if (CheckSystemEvents() == FALSE) {
 #ifndef USE_KEYBOARD_INPUT
-            ES_CheckUserEvents();
-#else
-            ;
+            ES_CheckUserEvents(); // only calls the checkers that are due
+#endif
+        }
+#ifdef USE_IDLE_WAIT
+        // still nothing to do, so sleep until the next interrupt
+        IdleUntilInterrupt();
 #endif
-
     }
 }
 
@@ -282,10 +364,8 @@ uint8_t ES_PostAll(ES_Event ThisEvent) {
     unsigned char i;
     // loop through the list executing the post functions
     for (i = 0; i < ARRAY_SIZE(EventQueues); i++) {
-        if (ES_EnQueueFIFO(EventQueues[i].pMem, ThisEvent) != TRUE) {
+        if (ES_PostToService(i, ThisEvent) != TRUE) {
             break; // this is a failed post
-        } else {
-            Ready |= (1 << i); // show queue as non-empty
         }
     }
     if (i == ARRAY_SIZE(EventQueues)) { // if no failures
@@ -306,20 +386,351 @@ uint8_t ES_PostAll(ES_Event ThisEvent) {
  Description
    posts to one of the services' queues
  Notes
-   used by the timer library to associate a timer with a state machine
+   used by the timer library to associate a timer with a state machine.
+   Events listed in ES_COALESCE_LIST may be merged with a pending event
+   instead of being queued, which still counts as a successful post.
+   Called from an interrupt handler, the event goes into the ring for that
+   interrupt priority level (the IPL field of the CP0 Status register is
+   only non-zero inside an ISR) and reaches the service queue from ES_Run.
  Author
    J. Edward Carryer, 01/16/12,
  ****************************************************************************/
 uint8_t ES_PostToService(uint8_t WhichService, ES_Event TheEvent) {
-    if ((WhichService < ARRAY_SIZE(EventQueues)) &&
-            (ES_EnQueueFIFO(EventQueues[WhichService].pMem, TheEvent) ==
-            TRUE)) {
-        Ready |= (1 << WhichService); // show queue as non-empty
-        return TRUE;
+#ifdef ES_ISR_QUEUE_LIST
+    unsigned int Ipl;
+#endif
+
+    if (WhichService < ARRAY_SIZE(EventQueues)) {
+#ifdef USE_EVENT_TIMESTAMPS
+        TheEvent.EventTime = _CP0_GET_COUNT();
+#endif
+#ifdef ES_ISR_QUEUE_LIST
+        Ipl = (_CP0_GET_STATUS() & _CP0_STATUS_IPL_MASK) >> _CP0_STATUS_IPL_POSITION;
+        if ((Ipl != 0) && (Ipl <= MAX_IPL) && (ISRQueueByIPL[Ipl] != NULL)) {
+            return ES_ISRQueue_Put(ISRQueueByIPL[Ipl], WhichService, TheEvent);
+        }
+#endif
+        return PostToQueue(WhichService, TheEvent);
     } else
         return FALSE;
 }
 
+/****************************************************************************
+ Function
+   ES_Publish
+ Parameters
+   ES_Event : The Event to be published
+ Returns
+   uint8_t : FALSE if the event type has no subscribers or a subscriber's
+             queue was full
+ Description
+   posts the event to every service that subscribes to its type in
+   ES_SUBSCRIPTION_LIST, in one pass over the subscriber mask
+ Notes
+   the publisher does not need to know who handles the event, so a service
+   can start listening to it without touching the code that posts it. From
+   an interrupt handler the event takes one entry in the ring, however many
+   subscribers it has, and is fanned out when ES_Run drains the ring.
+ ****************************************************************************/
+uint8_t ES_Publish(ES_Event ThisEvent) {
+    uint32_t Subscribers = GetSubscribers(ThisEvent.EventType);
+#ifdef ES_ISR_QUEUE_LIST
+    unsigned int Ipl;
+#endif
+
+    if (Subscribers == 0) {
+        return FALSE;
+    }
+#ifdef USE_EVENT_TIMESTAMPS
+    ThisEvent.EventTime = _CP0_GET_COUNT();
+#endif
+#ifdef ES_ISR_QUEUE_LIST
+    Ipl = (_CP0_GET_STATUS() & _CP0_STATUS_IPL_MASK) >> _CP0_STATUS_IPL_POSITION;
+    if ((Ipl != 0) && (Ipl <= MAX_IPL) && (ISRQueueByIPL[Ipl] != NULL)) {
+        return ES_ISRQueue_Put(ISRQueueByIPL[Ipl], ISR_PUBLISH, ThisEvent);
+    }
+#endif
+    return PublishToQueues(Subscribers, ThisEvent);
+}
+
+/****************************************************************************
+ Function
+   ES_GetQueueStats
+ Parameters
+   uint8_t : Which service's queue to report on (index into ServDescList)
+   ES_QueueStats_t * : filled in with the counters for that queue
+ Returns
+   uint8_t : FALSE if there is no such service
+ Description
+   reports how many posts to the queue were dropped because it was full and
+   how many were merged into a pending event
+ Notes
+   counted since reset
+ ****************************************************************************/
+uint8_t ES_GetQueueStats(uint8_t WhichService, ES_QueueStats_t *pStats) {
+    if (WhichService >= NUM_SERVICES) {
+        return FALSE;
+    }
+    *pStats = QueueStats[WhichService];
+    return TRUE;
+}
+
+/****************************************************************************
+ Function
+   ES_InitDeferralQueueWith
+ Parameters
+   ES_Event * : the block of memory to use as the deferral queue
+   uint8_t : number of ES_Events in the block (one more than it can hold)
+ Returns
+   uint8_t : max number of events the deferral queue can hold
+ Description
+   sets up (or empties) a service's deferral queue, declared as
+   static ES_Event DeferralQueue[n + 1] to hold n events
+ Notes
+   use ES_ClearDeferralQueue to throw away the events still deferred
+ ****************************************************************************/
+uint8_t ES_InitDeferralQueueWith(ES_Event *pBlock, uint8_t BlockSize) {
+    return ES_InitQueue(pBlock, BlockSize);
+}
+
+/****************************************************************************
+ Function
+   ES_ClearDeferralQueue
+ Parameters
+   ES_Event * : the deferral queue
+ Returns
+   uint8_t : the number of events thrown away
+ Description
+   throws away every deferred event, for when whatever they reported is no
+   longer true or the state that would recall them is not coming
+ Notes
+
+ ****************************************************************************/
+uint8_t ES_ClearDeferralQueue(ES_Event *pBlock) {
+    ES_Event DroppedEvent;
+    uint8_t NumDropped = 0;
+
+    while (ES_IsQueueEmpty(pBlock) == FALSE) {
+        ES_DeQueue(pBlock, &DroppedEvent);
+        NumDropped++;
+    }
+    return NumDropped;
+}
+
+/****************************************************************************
+ Function
+   ES_DeferEvent
+ Parameters
+   ES_Event * : the deferral queue
+   ES_Event : the event to park until a later state can handle it
+ Returns
+   uint8_t : FALSE if the deferral queue is full
+ Description
+   parks an event in the deferral queue until ES_RecallEvents
+ Notes
+
+ ****************************************************************************/
+uint8_t ES_DeferEvent(ES_Event *pBlock, ES_Event ThisEvent) {
+    return ES_EnQueueFIFO(pBlock, ThisEvent);
+}
+
+/****************************************************************************
+ Function
+   ES_RecallEvents
+ Parameters
+   uint8_t : Which service to recall the events to (index into ServDescList)
+   ES_Event * : the deferral queue
+ Returns
+   uint8_t : TRUE if any events were recalled
+ Description
+   moves every deferred event to the front of the service's queue, in the
+   order they were deferred, so they are handled before anything posted
+   since. Typically called on ES_ENTRY to the state that handles them.
+ Notes
+   events that do not fit in the service's queue are dropped and counted as
+   overflows
+ ****************************************************************************/
+uint8_t ES_RecallEvents(uint8_t WhichService, ES_Event *pBlock) {
+    ES_Event RecalledEvent;
+    uint8_t WereEventsPulled = FALSE;
+
+    if (WhichService >= ARRAY_SIZE(EventQueues)) {
+        return FALSE;
+    }
+    // pushing newest first onto the front keeps the deferred order
+    while (ES_IsQueueEmpty(pBlock) == FALSE) {
+        ES_DeQueueNewest(pBlock, &RecalledEvent);
+        if (ES_EnQueueLIFO(EventQueues[WhichService].pMem, RecalledEvent) == TRUE) {
+            Ready |= (1UL << WhichService); // show queue as non-empty
+            WereEventsPulled = TRUE;
+        } else {
+            QueueStats[WhichService].Overflows++;
+        }
+    }
+    return WereEventsPulled;
+}
+
+#ifdef USE_SERVICE_STATS
+/****************************************************************************
+ Function
+   ES_GetServiceStats
+ Parameters
+   uint8_t : Which service to report on (index into ServDescList)
+   ES_ServiceStats_t * : filled in with the statistics for that service
+ Returns
+   uint8_t : FALSE if there is no such service
+ Description
+   reports how many events the service has run and how long its run
+   function took to process them, in microseconds
+ Notes
+   statistics are collected since ES_Initialize or ES_ClearServiceStats
+ ****************************************************************************/
+uint8_t ES_GetServiceStats(uint8_t WhichService, ES_ServiceStats_t *pStats) {
+    ES_RunStats_t *pRunStats;
+
+    if (WhichService >= NUM_SERVICES) {
+        return FALSE;
+    }
+    pRunStats = &RunStats[WhichService];
+    pStats->Events = pRunStats->Events;
+    pStats->Overruns = pRunStats->Overruns;
+    if (pRunStats->Events == 0) {
+        pStats->MinTime = 0;
+        pStats->MaxTime = 0;
+        pStats->MeanTime = 0;
+    } else {
+        pStats->MinTime = pRunStats->MinTicks / ES_TIMESTAMP_TICKS_PER_US;
+        pStats->MaxTime = pRunStats->MaxTicks / ES_TIMESTAMP_TICKS_PER_US;
+        pStats->MeanTime = (pRunStats->TotalTicks / pRunStats->Events) / ES_TIMESTAMP_TICKS_PER_US;
+    }
+#ifdef USE_EVENT_TIMESTAMPS
+    pStats->MaxLatency = pRunStats->MaxLatencyTicks / ES_TIMESTAMP_TICKS_PER_US;
+    pStats->MeanLatency = pRunStats->Events ?
+            (uint32_t) ((pRunStats->TotalLatencyTicks / pRunStats->Events) / ES_TIMESTAMP_TICKS_PER_US) : 0;
+#endif
+    return TRUE;
+}
+
+/****************************************************************************
+ Function
+   ES_ClearServiceStats
+ Parameters
+   None
+ Returns
+   None
+ Description
+   restarts the run time statistics for all of the services
+ Notes
+
+ ****************************************************************************/
+void ES_ClearServiceStats(void) {
+    uint8_t i;
+
+    for (i = 0; i < NUM_SERVICES; i++) {
+        RunStats[i].Events = 0;
+        RunStats[i].MinTicks = UINT32_MAX;
+        RunStats[i].MaxTicks = 0;
+        RunStats[i].TotalTicks = 0;
+        RunStats[i].Overruns = 0;
+#ifdef USE_EVENT_TIMESTAMPS
+        RunStats[i].MaxLatencyTicks = 0;
+        RunStats[i].TotalLatencyTicks = 0;
+#endif
+    }
+    StatsStartTime = ES_Timer_GetTime();
+    ES_Timer_ClearISRTime();
+    ES_Timer_ClearSkippedNotifies();
+    ES_ClearCheckerStats();
+#ifdef USE_PERIOD_HISTOGRAMS
+    ES_Histogram_ClearAll();
+#endif
+#ifdef USE_IDLE_WAIT
+    IdleStats.Events = 0;
+    IdleStats.MinTicks = UINT32_MAX;
+    IdleStats.MaxTicks = 0;
+    IdleStats.TotalTicks = 0;
+    WakeStats.Events = 0;
+    WakeStats.MinTicks = UINT32_MAX;
+    WakeStats.MaxTicks = 0;
+    WakeStats.TotalTicks = 0;
+#endif
+}
+
+/****************************************************************************
+ Function
+   ES_PrintServiceStats
+ Parameters
+   None
+ Returns
+   None
+ Description
+   prints a table with the run time statistics for every service
+ Notes
+   this uses printf, call it from the idle loop or a debug state only
+ ****************************************************************************/
+void ES_PrintServiceStats(void) {
+    ES_ServiceStats_t Stats;
+    uint32_t TotalEvents = 0;
+    uint32_t Elapsed;
+    uint32_t Skipped;
+    uint32_t TickMean;
+    uint32_t TickMax;
+    uint8_t i;
+
+#ifdef USE_EVENT_TIMESTAMPS
+    printf("service: events min/mean/max us overruns overflows coalesced latency mean/max us\r\n");
+#else
+    printf("service: events min/mean/max us overruns overflows coalesced\r\n");
+#endif
+    for (i = 0; i < NUM_SERVICES; i++) {
+        ES_GetServiceStats(i, &Stats);
+        printf("%s: %u %u/%u/%u %u %u %u", ServiceNames[i], Stats.Events,
+                Stats.MinTime, Stats.MeanTime, Stats.MaxTime, Stats.Overruns,
+                QueueStats[i].Overflows, QueueStats[i].Coalesced);
+#ifdef USE_EVENT_TIMESTAMPS
+        printf(" %u/%u", Stats.MeanLatency, Stats.MaxLatency);
+#endif
+        printf("\r\n");
+        TotalEvents += Stats.Events;
+    }
+#ifdef ES_ISR_QUEUE_LIST
+    for (i = 0; i < ARRAY_SIZE(ISRQueues); i++) {
+        printf("isr ring %u: %u overflows\r\n", i, ISRQueues[i]->Overflows);
+    }
+#endif
+    ES_Timer_GetISRTime(&TickMean, &TickMax);
+    printf("timer tick isr: mean/max %u/%u us\r\n", TickMean, TickMax);
+    ES_PrintCheckerStats();
+    // overall dispatch rate, the figure to compare when changing what gets
+    // posted. The timer notifications that TIMER_NOTIFY_MASK left out would
+    // each have been dispatched too, so the same run gives the rate with them.
+    Elapsed = ES_Timer_GetTime() - StatsStartTime;
+    Skipped = ES_Timer_GetSkippedNotifies();
+    printf("total: %u events in %u ms, %u events/s\r\n", TotalEvents, Elapsed,
+            Elapsed ? (uint32_t) (((uint64_t) TotalEvents * 1000) / Elapsed) : 0);
+    printf("timer notifications not posted: %u, %u events/s with them\r\n", Skipped,
+            Elapsed ? (uint32_t) (((uint64_t) (TotalEvents + Skipped) * 1000) / Elapsed) : 0);
+#ifdef USE_IDLE_WAIT
+    // the number of waits, how long each lasted and the total time spent
+    // idle tell how much of the time the core was asleep
+    printf("idle: %u %u/%u/%u us, %u ms total\r\n", IdleStats.Events,
+            IdleStats.Events ? IdleStats.MinTicks / ES_TIMESTAMP_TICKS_PER_US : 0,
+            IdleStats.Events ? (uint32_t) ((IdleStats.TotalTicks / IdleStats.Events) / ES_TIMESTAMP_TICKS_PER_US) : 0,
+            IdleStats.MaxTicks / ES_TIMESTAMP_TICKS_PER_US,
+            (uint32_t) (IdleStats.TotalTicks / (ES_TIMESTAMP_TICKS_PER_US * 1000)));
+    // how long after the timer interrupt was raised the core was running
+    // again, for the waits the timer ended
+    printf("wake: %u %u/%u/%u ns\r\n", WakeStats.Events,
+            WakeStats.Events ? WakeStats.MinTicks * 1000 / ES_TIMESTAMP_TICKS_PER_US : 0,
+            WakeStats.Events ? (uint32_t) ((WakeStats.TotalTicks * 1000 / WakeStats.Events) / ES_TIMESTAMP_TICKS_PER_US) : 0,
+            WakeStats.MaxTicks * 1000 / ES_TIMESTAMP_TICKS_PER_US);
+#endif
+#ifdef USE_PERIOD_HISTOGRAMS
+    ES_Histogram_PrintAll();
+#endif
+}
+#endif
+
 
 //*********************************
 // private functions
@@ -362,5 +773,273 @@ static uint8_t CheckSystemEvents(void) {
     return FALSE;
 }
 
+/****************************************************************************
+ Function
+   PostToQueue
+ Parameters
+   uint8_t : Which queue to post to (index into EventQueues)
+   ES_Event : The Event to be posted
+ Returns
+   uint8_t : FALSE if the queue was full
+ Description
+   a publish with a single subscriber
+ Notes
+   WhichQueue must already have been range checked
+ ****************************************************************************/
+static uint8_t PostToQueue(uint8_t WhichQueue, ES_Event TheEvent) {
+    return PublishToQueues(1UL << WhichQueue, TheEvent);
+}
+
+/****************************************************************************
+ Function
+   PublishToQueues
+ Parameters
+   uint32_t : the queues to post to, bit n for EventQueues[n]
+   ES_Event : The Event to be posted
+ Returns
+   uint8_t : FALSE if any of the queues was full
+ Description
+   applies the coalescing policy for the event type to each queue, queues
+   the event in the ones it was not merged into, and counts both outcomes.
+   The Ready bits of every queue that took the event are set together once
+   they all have it.
+ Notes
+   highest priority queue first, every bit must be a real service
+ ****************************************************************************/
+static uint8_t PublishToQueues(uint32_t Subscribers, ES_Event TheEvent) {
+    uint8_t Policy = ES_COALESCE_NONE;
+    uint32_t NowReady = 0;
+    uint8_t ReturnVal = TRUE;
+    uint8_t WhichQueue;
+
+    if (TheEvent.EventType < ARRAY_SIZE(CoalescePolicy)) {
+        Policy = CoalescePolicy[TheEvent.EventType];
+    }
+    while (Subscribers != 0) {
+        WhichQueue = ES_GetMSBitNum(Subscribers);
+        Subscribers &= ~(1UL << WhichQueue);
+        if ((Policy != ES_COALESCE_NONE) &&
+                (ES_CoalesceInQueue(EventQueues[WhichQueue].pMem, TheEvent,
+                Policy == ES_COALESCE_LATEST) == TRUE)) {
+            QueueStats[WhichQueue].Coalesced++;
+        } else if (ES_EnQueueFIFO(EventQueues[WhichQueue].pMem, TheEvent) == TRUE) {
+            NowReady |= (1UL << WhichQueue);
+        } else {
+            QueueStats[WhichQueue].Overflows++;
+            ReturnVal = FALSE;
+        }
+    }
+    Ready |= NowReady; // show the queues as non-empty
+    return ReturnVal;
+}
+
+/****************************************************************************
+ Function
+   GetSubscribers
+ Parameters
+   ES_EventTyp_t : the event type
+ Returns
+   uint32_t : the services subscribed to it, bit n for service n
+ Description
+   looks the event type up in ES_SUBSCRIPTION_LIST
+ Notes
+
+ ****************************************************************************/
+static uint32_t GetSubscribers(ES_EventTyp_t EventType) {
+    if (EventType < ARRAY_SIZE(SubscriberMask)) {
+        return SubscriberMask[EventType];
+    }
+    return 0;
+}
+
+#ifdef ES_ISR_QUEUE_LIST
+/****************************************************************************
+ Function
+   DrainISRQueues
+ Parameters
+   None
+ Returns
+   None
+ Description
+   moves every event waiting in the ISR rings into its service queue
+ Notes
+   only called from ES_Run, which is the one consumer of every ring
+ ****************************************************************************/
+static void DrainISRQueues(void) {
+    ES_Event ThisEvent;
+    uint8_t WhichService;
+    uint8_t i;
+
+    for (i = 0; i < ARRAY_SIZE(ISRQueues); i++) {
+        while (ES_ISRQueue_Get(ISRQueues[i], &WhichService, &ThisEvent) == TRUE) {
+            if (WhichService == ISR_PUBLISH) {
+                PublishToQueues(GetSubscribers(ThisEvent.EventType), ThisEvent);
+            } else {
+                PostToQueue(WhichService, ThisEvent);
+            }
+        }
+    }
+}
+
+/****************************************************************************
+ Function
+   AreISRQueuesEmpty
+ Parameters
+   None
+ Returns
+   uint8_t : TRUE if none of the ISR rings hold an event
+ Description
+   see above
+ Notes
+
+ ****************************************************************************/
+static uint8_t AreISRQueuesEmpty(void) {
+    uint8_t i;
+
+    for (i = 0; i < ARRAY_SIZE(ISRQueues); i++) {
+        if (ES_ISRQueue_IsEmpty(ISRQueues[i]) == FALSE) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+#endif
+
+#ifdef USE_SERVICE_STATS
+/****************************************************************************
+ Function
+   UpdateServiceStats
+ Parameters
+   uint8_t : the service whose run function just returned
+   uint32_t : how long the run function took, in core timer ticks
+ Returns
+   None
+ Description
+   folds one run of a service into its statistics, counting it as an
+   overrun if it went over the service's budget
+ Notes
+   runs after every event, so it only counts and hands the overrun to the
+   deferred log. The totals are reported by ES_PrintServiceStats.
+ ****************************************************************************/
+static void UpdateServiceStats(uint8_t WhichService, uint32_t RunTicks) {
+    ES_RunStats_t *pRunStats = &RunStats[WhichService];
+
+    pRunStats->Events++;
+    pRunStats->TotalTicks += RunTicks;
+    if (RunTicks < pRunStats->MinTicks) {
+        pRunStats->MinTicks = RunTicks;
+    }
+    if (RunTicks > pRunStats->MaxTicks) {
+        pRunStats->MaxTicks = RunTicks;
+    }
+    if ((ServiceBudget[WhichService] != 0) && (RunTicks > ServiceBudget[WhichService])) {
+        pRunStats->Overruns++;
+        ES_LOG2(LOG_OVER_BUDGET, ServiceNames[WhichService], RunTicks / ES_TIMESTAMP_TICKS_PER_US);
+    }
+}
+
+#ifdef USE_EVENT_TIMESTAMPS
+/****************************************************************************
+ Function
+   UpdateLatencyStats
+ Parameters
+   uint8_t : the service that just ran an event
+   uint32_t : core timer ticks from when the event was posted to the run
+ Returns
+   None
+ Description
+   folds the wait of one event into the service's statistics
+ Notes
+   the wait includes any time the event spent in an ISR ring or deferred
+ ****************************************************************************/
+static void UpdateLatencyStats(uint8_t WhichService, uint32_t LatencyTicks) {
+    ES_RunStats_t *pRunStats = &RunStats[WhichService];
+
+    pRunStats->TotalLatencyTicks += LatencyTicks;
+    if (LatencyTicks > pRunStats->MaxLatencyTicks) {
+        pRunStats->MaxLatencyTicks = LatencyTicks;
+    }
+}
+#endif
+#endif
+
+#ifdef USE_IDLE_WAIT
+/****************************************************************************
+ Function
+   IdleUntilInterrupt
+ Parameters
+   None
+ Returns
+   None
+ Description
+   puts the core into idle mode with the wait instruction until the next
+   interrupt, unless an event was posted since the queues were last checked
+ Notes
+   interrupts are disabled around the test of Ready so that a post from an
+   ISR cannot slip in between the test and the wait. The M4K core leaves the
+   wait state on any pending interrupt even with interrupts disabled, and the
+   ISR runs as soon as the previous interrupt state is restored.
+   OSCCON.SLPEN is left clear so wait selects idle (peripherals keep running)
+   rather than sleep.
+   With USE_SERVICE_STATS the wake up latency is taken from the timer that
+   ended the wait. The ISR cannot stamp it, it only runs once the status is
+   restored below. Timer1 restarts from 0 on the match that raises T1IF and
+   counts the peripheral clock, F_CPU/2 like the core timer, so TMR1 is the
+   number of core ticks since the interrupt. For the tickless timers it is
+   the count past the compare. If the interrupt was raised just before the
+   wait, the wait returns at once and the figure is the time since then.
+ ****************************************************************************/
+static void IdleUntilInterrupt(void) {
+    unsigned int SavedStatus;
+#ifdef USE_SERVICE_STATS
+    uint32_t IdleStart;
+    uint32_t IdleTicks;
+    uint32_t WakeTicks;
+    uint8_t TimerWoke;
+#endif
+
+    SavedStatus = __builtin_disable_interrupts();
+#ifdef ES_ISR_QUEUE_LIST
+    if ((Ready == 0) && (AreISRQueuesEmpty() == TRUE)) {
+#else
+    if (Ready == 0) {
+#endif
+#ifdef USE_SERVICE_STATS
+        IdleStart = _CP0_GET_COUNT();
+#endif
+        _wait();
+#ifdef USE_SERVICE_STATS
+#ifdef USE_TICKLESS_TIMERS
+        WakeTicks = _CP0_GET_COUNT() - _CP0_GET_COMPARE();
+        TimerWoke = ((IFS0 & _IFS0_CTIF_MASK) != 0);
+#else
+        WakeTicks = TMR1;
+        TimerWoke = ((IFS0 & _IFS0_T1IF_MASK) != 0);
+#endif
+        IdleTicks = _CP0_GET_COUNT() - IdleStart;
+        IdleStats.Events++;
+        IdleStats.TotalTicks += IdleTicks;
+        if (IdleTicks < IdleStats.MinTicks) {
+            IdleStats.MinTicks = IdleTicks;
+        }
+        if (IdleTicks > IdleStats.MaxTicks) {
+            IdleStats.MaxTicks = IdleTicks;
+        }
+        if (TimerWoke) {
+            WakeStats.Events++;
+            WakeStats.TotalTicks += WakeTicks;
+            if (WakeTicks < WakeStats.MinTicks) {
+                WakeStats.MinTicks = WakeTicks;
+            }
+            if (WakeTicks > WakeStats.MaxTicks) {
+                WakeStats.MaxTicks = WakeTicks;
+            }
+        }
+#endif
+    }
+    __builtin_mtc0(_CP0_STATUS, _CP0_STATUS_SELECT, SavedStatus);
+}
+#endif
+
 /*------------------------------- Footnotes -------------------------------*/
 /*------------------------------ End of file ------------------------------*/
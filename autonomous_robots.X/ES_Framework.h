@@ -18,14 +18,19 @@
 #include <inttypes.h>
 #include "ES_Events.h"
 #include "ES_Timers.h"
+#include "ES_HRTimers.h"
+#include "ES_PeriodicTasks.h"
+#include "ES_Histogram.h"
+#include "ES_Hysteresis.h"
+#include "ES_Log.h"
 #include "ES_CheckEvents.h"
 #include "ES_General.h"
 #include "ES_KeyboardInput.h"
 #include "ES_LookupTables.h"
 #include "ES_Port.h"
-#include "ES_PostList.h"
 #include "ES_PriorTables.h"
 #include "ES_Queue.h"
+#include "ES_ISRQueue.h"
 #include "ES_ServiceHeaders.h"
 #include "ES_TattleTale.h"
 #include "ES_Timers.h"
@@ -42,12 +47,50 @@ typedef enum {
               FailedInit
 } ES_Return_t;
 
+typedef struct {
+    uint32_t Events; // number of events the service has run
+    uint32_t MinTime; // shortest run of the service, in microseconds
+    uint32_t MeanTime; // average run of the service, in microseconds
+    uint32_t MaxTime; // longest run of the service, in microseconds
+    uint32_t Overruns; // number of runs longer than the service's budget
+#ifdef USE_EVENT_TIMESTAMPS
+    uint32_t MeanLatency; // average time from post to run, in microseconds
+    uint32_t MaxLatency; // longest time from post to run, in microseconds
+#endif
+} ES_ServiceStats_t;
+
+// what ES_PostToService does with an event of a type that is already pending
+// in the target queue, see ES_COALESCE_LIST in ES_Configure.h
+typedef enum {
+    ES_COALESCE_NONE = 0, // always queue the event (the default)
+    ES_COALESCE_DUPLICATE, // drop it if the pending event has the same param
+    ES_COALESCE_LATEST // overwrite the param of a pending event that is the newest one queued
+} ES_CoalescePolicy_t;
+
+typedef struct {
+    uint32_t Overflows; // number of posts dropped because the queue was full
+    uint32_t Coalesced; // number of posts merged into a pending event
+} ES_QueueStats_t;
+
 ES_Return_t ES_Initialize( void );
 
 
 ES_Return_t ES_Run( void );
 uint8_t ES_PostAll( ES_Event ThisEvent );
 uint8_t ES_PostToService( uint8_t WhichService, ES_Event ThisEvent);
+uint8_t ES_Publish( ES_Event ThisEvent );
+uint8_t ES_GetQueueStats( uint8_t WhichService, ES_QueueStats_t *pStats );
+
+uint8_t ES_InitDeferralQueueWith( ES_Event *pBlock, uint8_t BlockSize );
+uint8_t ES_ClearDeferralQueue( ES_Event *pBlock );
+uint8_t ES_DeferEvent( ES_Event *pBlock, ES_Event ThisEvent );
+uint8_t ES_RecallEvents( uint8_t WhichService, ES_Event *pBlock );
+
+#ifdef USE_SERVICE_STATS
+uint8_t ES_GetServiceStats( uint8_t WhichService, ES_ServiceStats_t *pStats );
+void ES_ClearServiceStats( void );
+void ES_PrintServiceStats( void );
+#endif
 
 
 
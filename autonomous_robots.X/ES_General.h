@@ -3,4 +3,9 @@
 
 #define ARRAY_SIZE(x)  (sizeof(x)/sizeof(x[0]))
 
-#endif//ES_General_H
\ No newline at end of file
+// number of the most significant set bit in a non-zero value, used to pick
+// the highest priority entry out of a ready mask. On the PIC32 this compiles
+// down to a single clz instruction, so no loop or lookup table is needed.
+#define ES_GetMSBitNum(x)  (31 - __builtin_clz((unsigned int)(x)))
+
+#endif//ES_General_H
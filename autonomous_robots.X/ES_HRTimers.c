@@ -0,0 +1,382 @@
+/****************************************************************************
+ Module
+     ES_HRTimers.c
+
+ Description
+     High resolution one shot and periodic timers, counted in 10 us ticks
+     (ES_HR_TICK_US) on Timer5, for the jobs the 1 ms ES timers are too
+     coarse for, such as stepping the tape sensor LED and sampling through
+     its settle time.
+
+ Notes
+     Timer5 is not left ticking. It runs one period up to the nearest expiry
+     (at most 65536 counts, 26 ms at 1:16, longer times take several
+     periods) and is stopped while nothing is running. At the end of a
+     period the hardware restarts TMR5 from 0 by itself, so the interrupt
+     carries on from there without losing counts and periodic timers don't
+     drift; only starting or stopping a timer stops Timer5 for a moment.
+     Its interrupt runs at priority 4, above the ES tick, and posts through
+     the ISR ring for that level, see ES_ISR_QUEUE_LIST.
+ ****************************************************************************/
+
+/*----------------------------- Include Files -----------------------------*/
+
+#include <xc.h>
+#include <sys/attribs.h>
+#include <BOARD.h>
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "ES_ServiceHeaders.h"
+#include "ES_HRTimers.h"
+
+#ifdef USE_HR_TIMERS
+/*----------------------------- Module Defines ----------------------------*/
+#define F_PB 40000000L
+#define HR_PRESCALE_BITS 4 // TCKPS value for 1:16
+#define HR_PRESCALE 16
+#define COUNTS_PER_HR_TICK ((F_PB / HR_PRESCALE) / (1000000L / ES_HR_TICK_US))
+#define MAX_HR_PERIOD 0x10000 // counts in a full Timer5 period
+#define HR_MIN_LEAD 4 // counts of margin when a period end has already passed
+#define HR_TIMER_IPL 4
+#define TranslateHRTimer(x) (1U<<(x))
+
+/*---------------------------- Module Functions ---------------------------*/
+static void AdvanceHRTimers(uint32_t Elapsed);
+static void CatchUpHRTimers(void);
+static ES_TimerReturn_t ArmHRTimer(uint8_t Num, uint16_t NewTime, uint16_t Period);
+static void ScheduleHRTimer(void);
+static uint32_t LockHRTimers(void);
+static void UnlockHRTimers(uint32_t SavedStatus);
+
+/*---------------------------- Module Variables ---------------------------*/
+// Timer5 counts left for each running timer, as of the start of the current
+// period
+static uint32_t HRRemaining[NUM_HR_TIMERS];
+// Timer5 counts between the timeouts of each periodic timer, 0 for one shot
+static uint32_t HRReload[NUM_HR_TIMERS];
+static uint8_t HRActiveFlags;
+// counts in the period Timer5 is running now, 0 while it is stopped
+static uint32_t HRPeriod;
+
+static pPostFunc const HRTimer2PostFunc[NUM_HR_TIMERS] = {HRTIMER0_RESP_FUNC,
+    HRTIMER1_RESP_FUNC,
+    HRTIMER2_RESP_FUNC,
+    HRTIMER3_RESP_FUNC};
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+     ES_HRTimer_Init
+ Parameters
+     None.
+ Returns
+     None.
+ Description
+     sets up Timer5 and its interrupt, with every timer stopped
+ Notes
+     called from ES_Initialize after the ISR rings are set up
+ ****************************************************************************/
+void ES_HRTimer_Init(void) {
+    IEC0CLR = _IEC0_T5IE_MASK;
+    T5CON = 0;
+    TMR5 = 0;
+    T5CONbits.TCKPS = HR_PRESCALE_BITS;
+    HRActiveFlags = 0;
+    HRPeriod = 0;
+    IPC5bits.T5IP = HR_TIMER_IPL;
+    IFS0CLR = _IFS0_T5IF_MASK;
+    IEC0SET = _IEC0_T5IE_MASK;
+}
+
+/****************************************************************************
+ Function
+     ES_HRTimer_InitTimer
+ Parameters
+     uint8_t Num : the high resolution timer to start
+     uint16_t NewTime : number of 10 us ticks to count
+ Returns
+     ES_TimerReturn_t : ES_Timer_ERR for a bad timer number, a timer with no
+     post function or a time of 0, else ES_Timer_OK
+ Description
+     (re)starts the timer counting NewTime from now
+ Notes
+
+ ****************************************************************************/
+ES_TimerReturn_t ES_HRTimer_InitTimer(uint8_t Num, uint16_t NewTime) {
+    return ArmHRTimer(Num, NewTime, 0);
+}
+
+/****************************************************************************
+ Function
+     ES_HRTimer_InitPeriodicTimer
+ Parameters
+     uint8_t Num : the high resolution timer to start
+     uint16_t Period : number of 10 us ticks between timeouts
+ Returns
+     ES_TimerReturn_t : ES_Timer_ERR for a bad timer number, a timer with no
+     post function or a period of 0, else ES_Timer_OK
+ Description
+     (re)starts the timer posting ES_HR_TIMEOUT every Period ticks until it
+     is stopped or started again as a one shot timer
+ Notes
+     the ISR reloads it from the moment it was due
+ ****************************************************************************/
+ES_TimerReturn_t ES_HRTimer_InitPeriodicTimer(uint8_t Num, uint16_t Period) {
+    return ArmHRTimer(Num, Period, Period);
+}
+
+/****************************************************************************
+ Function
+     ES_HRTimer_StopTimer
+ Parameters
+     uint8_t Num : the high resolution timer to stop
+ Returns
+     ES_TimerReturn_t : ES_Timer_ERR for a bad timer number, else ES_Timer_OK
+ Description
+     stops the timer, nothing is posted
+ Notes
+
+ ****************************************************************************/
+ES_TimerReturn_t ES_HRTimer_StopTimer(uint8_t Num) {
+    uint32_t SavedStatus;
+
+    if (Num >= NUM_HR_TIMERS)
+        return ES_Timer_ERR;
+    SavedStatus = LockHRTimers();
+    HRActiveFlags &= ~TranslateHRTimer(Num);
+    UnlockHRTimers(SavedStatus);
+    return ES_Timer_OK;
+}
+
+/****************************************************************************
+ Function
+     ES_HRTimer_IsTimerActive
+ Parameters
+     uint8_t Num : the high resolution timer to test
+ Returns
+     ES_TimerReturn_t : ES_Timer_ERR for a bad timer number, ES_Timer_ACTIVE
+     if it is running, else ES_Timer_NOT_ACTIVE
+ Description
+     see above
+ Notes
+
+ ****************************************************************************/
+ES_TimerReturn_t ES_HRTimer_IsTimerActive(uint8_t Num) {
+    if (Num >= NUM_HR_TIMERS)
+        return ES_Timer_ERR;
+    if (HRActiveFlags & TranslateHRTimer(Num))
+        return ES_Timer_ACTIVE;
+    return ES_Timer_NOT_ACTIVE;
+}
+
+/****************************************************************************
+ Function
+     HRTimerIntHandler
+ Parameters
+     None.
+ Returns
+     None.
+ Description
+     the end of a Timer5 period, posts the timers that are due and sets
+     the period up to the next one
+ Notes
+     TMR5 has already started counting the next period
+ ****************************************************************************/
+void __ISR(_TIMER_5_VECTOR, ipl4auto) HRTimerIntHandler(void) {
+    IFS0CLR = _IFS0_T5IF_MASK;
+    AdvanceHRTimers(HRPeriod);
+    ScheduleHRTimer();
+}
+
+/****************************************************************************
+ private functions
+ ****************************************************************************/
+
+/****************************************************************************
+ Function
+     ArmHRTimer
+ Parameters
+     uint8_t Num : the high resolution timer to (re)start
+     uint16_t NewTime : 10 us ticks until it first expires
+     uint16_t Period : 10 us ticks between later expiries, 0 for one shot
+ Returns
+     ES_TimerReturn_t : ES_Timer_ERR for a bad timer number, a timer with no
+     post function or a time of 0, else ES_Timer_OK
+ Description
+     the common part of ES_HRTimer_InitTimer and
+     ES_HRTimer_InitPeriodicTimer
+ Notes
+
+ ****************************************************************************/
+static ES_TimerReturn_t ArmHRTimer(uint8_t Num, uint16_t NewTime, uint16_t Period) {
+    uint32_t SavedStatus;
+
+    if ((Num >= NUM_HR_TIMERS) || (HRTimer2PostFunc[Num] == TIMER_UNUSED) ||
+            (NewTime == 0))
+        return ES_Timer_ERR;
+    SavedStatus = LockHRTimers();
+    HRRemaining[Num] = (uint32_t) NewTime * COUNTS_PER_HR_TICK;
+    HRReload[Num] = (uint32_t) Period * COUNTS_PER_HR_TICK;
+    HRActiveFlags |= TranslateHRTimer(Num);
+    UnlockHRTimers(SavedStatus);
+    return ES_Timer_OK;
+}
+
+/****************************************************************************
+ Function
+     AdvanceHRTimers
+ Parameters
+     uint32_t Elapsed : Timer5 counts that have gone by
+ Returns
+     None.
+ Description
+     takes Elapsed off every running timer and posts ES_HR_TIMEOUT for the
+     ones that have run out. A periodic timer is reloaded from the moment it
+     was due; periods that were missed altogether are skipped.
+ Notes
+     called from the interrupt, or with the timers locked
+ ****************************************************************************/
+static void AdvanceHRTimers(uint32_t Elapsed) {
+    ES_Event NewEvent;
+    uint32_t Late;
+    uint8_t Num;
+
+    for (Num = 0; Num < NUM_HR_TIMERS; Num++) {
+        if ((HRActiveFlags & TranslateHRTimer(Num)) == 0)
+            continue;
+        if (HRRemaining[Num] > Elapsed) {
+            HRRemaining[Num] -= Elapsed;
+            continue;
+        }
+        if (HRReload[Num] != 0) {
+            Late = Elapsed - HRRemaining[Num];
+            HRRemaining[Num] = HRReload[Num] - (Late % HRReload[Num]);
+        } else {
+            HRActiveFlags &= ~TranslateHRTimer(Num);
+        }
+        NewEvent.EventType = ES_HR_TIMEOUT;
+        NewEvent.EventParam = Num;
+        HRTimer2PostFunc[Num](NewEvent);
+    }
+}
+
+/****************************************************************************
+ Function
+     CatchUpHRTimers
+ Parameters
+     None.
+ Returns
+     None.
+ Description
+     stops Timer5 and takes the counts since the start of the period off
+     every running timer
+ Notes
+     called with the timers locked. If the period ended while locked the
+     flag is still set and TMR5 has started again from 0, so the whole
+     period is added to the count.
+ ****************************************************************************/
+static void CatchUpHRTimers(void) {
+    uint32_t Elapsed;
+
+    if (HRPeriod == 0)
+        return;
+    T5CONCLR = _T5CON_ON_MASK;
+    Elapsed = TMR5;
+    if (IFS0 & _IFS0_T5IF_MASK) {
+        Elapsed += HRPeriod;
+        IFS0CLR = _IFS0_T5IF_MASK;
+    }
+    TMR5 = 0;
+    AdvanceHRTimers(Elapsed);
+}
+
+/****************************************************************************
+ Function
+     ScheduleHRTimer
+ Parameters
+     None.
+ Returns
+     None.
+ Description
+     sets the Timer5 period to end at the nearest expiry, or a full period
+     if that is further off. Timer5 is stopped if nothing is running.
+ Notes
+     with Timer5 stopped the period starts now. From the interrupt it is
+     still running and the period counts from the end of the last one; if
+     that end has already gone by the period is stretched to end straight
+     away, and HRPeriod always matches PR5 so the next catch up is exact.
+ ****************************************************************************/
+static void ScheduleHRTimer(void) {
+    uint32_t Period = MAX_HR_PERIOD;
+    uint32_t Now;
+    uint8_t Num;
+
+    if (HRActiveFlags == 0) {
+        T5CONCLR = _T5CON_ON_MASK;
+        TMR5 = 0;
+        HRPeriod = 0;
+        return;
+    }
+    for (Num = 0; Num < NUM_HR_TIMERS; Num++) {
+        if ((HRActiveFlags & TranslateHRTimer(Num)) && (HRRemaining[Num] < Period))
+            Period = HRRemaining[Num];
+    }
+    if (T5CON & _T5CON_ON_MASK) {
+        Now = TMR5;
+        if (Period < Now + HR_MIN_LEAD)
+            Period = Now + HR_MIN_LEAD;
+        if (Period > MAX_HR_PERIOD)
+            Period = MAX_HR_PERIOD;
+    }
+    PR5 = Period - 1;
+    HRPeriod = Period;
+    T5CONSET = _T5CON_ON_MASK;
+}
+
+/****************************************************************************
+ Function
+     LockHRTimers
+ Parameters
+     None.
+ Returns
+     uint32_t : the CPU status, with the interrupt priority as it was
+ Description
+     raises the CPU priority to that of the Timer5 interrupt and brings the
+     running timers up to date, so that times set while locked count from now
+ Notes
+     raising the priority rather than masking Timer5 also holds off the
+     other level 4 interrupts, so the timers can be started and stopped from
+     any interrupt up to level 4 (the beacon edge interrupt does). The ES
+     tick keeps running; lower priority interrupts wait a few microseconds.
+ ****************************************************************************/
+static uint32_t LockHRTimers(void) {
+    uint32_t SavedStatus = _CP0_GET_STATUS();
+
+    if (((SavedStatus & _CP0_STATUS_IPL_MASK) >> _CP0_STATUS_IPL_POSITION) < HR_TIMER_IPL) {
+        _CP0_SET_STATUS((SavedStatus & ~_CP0_STATUS_IPL_MASK) |
+                (HR_TIMER_IPL << _CP0_STATUS_IPL_POSITION));
+    }
+    CatchUpHRTimers();
+    return SavedStatus;
+}
+
+/****************************************************************************
+ Function
+     UnlockHRTimers
+ Parameters
+     uint32_t SavedStatus : what LockHRTimers returned
+ Returns
+     None.
+ Description
+     starts the period up to the next expiry and puts the CPU priority back
+     the way LockHRTimers found it
+ Notes
+
+ ****************************************************************************/
+static void UnlockHRTimers(uint32_t SavedStatus) {
+    ScheduleHRTimer();
+    _CP0_SET_STATUS((_CP0_GET_STATUS() & ~_CP0_STATUS_IPL_MASK) |
+            (SavedStatus & _CP0_STATUS_IPL_MASK));
+}
+#endif /* USE_HR_TIMERS */
+/*------------------------------ End of file ------------------------------*/
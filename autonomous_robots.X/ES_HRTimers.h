@@ -0,0 +1,65 @@
+/****************************************************************************
+ Module
+         ES_HRTimers.h
+
+ Description
+         Header File for the high resolution one shot and periodic timers,
+         counted in 10 us ticks on Timer5 alongside the 1 ms ES timers
+
+ Notes
+         enabled with USE_HR_TIMERS in ES_Configure.h. An expired timer posts
+         ES_HR_TIMEOUT with the timer number in EventParam to the function
+         given by HRTIMERn_RESP_FUNC.
+
+****************************************************************************/
+
+#ifndef ES_HRTimers_H
+#define ES_HRTimers_H
+
+#include <inttypes.h>
+#include "ES_Timers.h"
+
+#define ES_HR_TICK_US 10 // length of one high resolution tick, in microseconds
+
+/**
+ * @Function ES_HRTimer_Init(void)
+ * @param none
+ * @return None.
+ * @brief  Sets up Timer5 for the high resolution timers, leaving it stopped
+ *         until a timer is started */
+void             ES_HRTimer_Init(void);
+
+/**
+ * @Function ES_HRTimer_InitTimer(uint8_t Num, uint16_t NewTime)
+ * @param Num -  the number of the high resolution timer to start
+ * @param NewTime - the number of 10 us ticks to be counted, from 1 to 65535
+ * @return ES_Timer_ERR or ES_Timer_OK
+ * @brief  (re)starts the timer, an expiry still pending from its last run is
+ *         dropped */
+ES_TimerReturn_t ES_HRTimer_InitTimer(uint8_t Num, uint16_t NewTime);
+
+/**
+ * @Function ES_HRTimer_StopTimer(uint8_t Num)
+ * @param Num - the number of the high resolution timer to stop.
+ * @return ES_Timer_ERR or ES_Timer_OK
+ * @brief  stops the timer without posting anything */
+ES_TimerReturn_t ES_HRTimer_StopTimer(uint8_t Num);
+
+/**
+ * @Function ES_HRTimer_InitPeriodicTimer(uint8_t Num, uint16_t Period)
+ * @param Num -  the number of the high resolution timer to start
+ * @param Period - the number of 10 us ticks between timeouts, from 1 to 65535
+ * @return ES_Timer_ERR or ES_Timer_OK
+ * @brief  (re)starts the timer posting ES_HR_TIMEOUT every Period ticks,
+ *         reloaded in the ISR without drift, until it is stopped or started
+ *         again with ES_HRTimer_InitTimer */
+ES_TimerReturn_t ES_HRTimer_InitPeriodicTimer(uint8_t Num, uint16_t Period);
+
+/**
+ * @Function ES_HRTimer_IsTimerActive(uint8_t Num)
+ * @param Num - the number of the high resolution timer to test.
+ * @return ES_Timer_ERR, ES_Timer_ACTIVE or ES_Timer_NOT_ACTIVE */
+ES_TimerReturn_t ES_HRTimer_IsTimerActive(uint8_t Num);
+
+#endif   /* ES_HRTimers_H */
+/*------------------------------ End of file ------------------------------*/
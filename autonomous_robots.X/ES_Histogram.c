@@ -0,0 +1,204 @@
+/****************************************************************************
+ Module
+     ES_Histogram.c
+ Description
+     Period histograms. A service calls ES_Histogram_Mark every time its
+     recurring event comes round, and the time since the last mark is
+     binned around the period it is meant to have, so the jitter it really
+     sees (timer, queueing and dispatch together) can be printed.
+ Notes
+     Marks are a few instructions and no division beyond the bin lookup, so
+     they can stay in the run functions. Printing uses printf.
+*****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include "ES_Configure.h"
+#include "ES_Histogram.h"
+#include "ES_Timers.h"
+#include <stdio.h>
+#include <xc.h>
+#include <BOARD.h>
+
+/*----------------------------- Module Defines ----------------------------*/
+
+/*---------------------------- Module Variables ---------------------------*/
+// every histogram set up with ES_Histogram_Init, for the PrintAll/ClearAll
+static ES_Histogram_t *Histograms[ES_MAX_HISTOGRAMS];
+static uint8_t NumHistograms = 0;
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+   ES_Histogram_Init
+ Parameters
+   ES_Histogram_t * pHist : the histogram to set up
+   const char * Name : printed in front of it
+   uint32_t NominalUs : the period the event is meant to have
+   uint32_t BinUs : the width of each bin, in microseconds
+ Returns
+   None.
+ Description
+   empties the histogram and adds it to the list ES_Histogram_PrintAll goes
+   through
+ Notes
+   the list holds the first ES_MAX_HISTOGRAMS, calling this again for the
+   same histogram does not add it twice
+****************************************************************************/
+void ES_Histogram_Init( ES_Histogram_t *pHist, const char *Name,
+                        uint32_t NominalUs, uint32_t BinUs )
+{
+   uint8_t i;
+
+   pHist->Name = Name;
+   pHist->NominalUs = NominalUs;
+   pHist->BinUs = (BinUs != 0) ? BinUs : 1;
+   ES_Histogram_Clear(pHist);
+   for (i = 0; i < NumHistograms; i++) {
+      if (Histograms[i] == pHist)
+         return;
+   }
+   if (NumHistograms < ES_MAX_HISTOGRAMS)
+      Histograms[NumHistograms++] = pHist;
+}
+
+/****************************************************************************
+ Function
+   ES_Histogram_Mark
+ Parameters
+   ES_Histogram_t * pHist : the histogram to add to
+ Returns
+   None.
+ Description
+   bins the time since the last mark; the first mark after a clear only
+   starts the timing
+ Notes
+
+****************************************************************************/
+void ES_Histogram_Mark( ES_Histogram_t *pHist )
+{
+   uint32_t Now = _CP0_GET_COUNT();
+   uint32_t PeriodUs;
+   int32_t Offset;
+   int32_t Bin;
+
+   if (pHist->Started == FALSE) {
+      pHist->Started = TRUE;
+      pHist->LastTicks = Now;
+      return;
+   }
+   PeriodUs = (Now - pHist->LastTicks) / ES_TIMESTAMP_TICKS_PER_US;
+   pHist->LastTicks = Now;
+   pHist->Count++;
+   if (PeriodUs < pHist->MinUs)
+      pHist->MinUs = PeriodUs;
+   if (PeriodUs > pHist->MaxUs)
+      pHist->MaxUs = PeriodUs;
+   Offset = (int32_t)(PeriodUs - pHist->NominalUs) +
+            (int32_t)(pHist->BinUs * (ES_HISTOGRAM_BINS / 2));
+   Bin = (Offset < 0) ? 0 : Offset / (int32_t)pHist->BinUs;
+   if (Bin >= ES_HISTOGRAM_BINS)
+      Bin = ES_HISTOGRAM_BINS - 1;
+   pHist->Bins[Bin]++;
+}
+
+/****************************************************************************
+ Function
+   ES_Histogram_Clear
+ Parameters
+   ES_Histogram_t * pHist : the histogram to empty
+ Returns
+   None.
+ Description
+   see above
+ Notes
+
+****************************************************************************/
+void ES_Histogram_Clear( ES_Histogram_t *pHist )
+{
+   uint8_t i;
+
+   pHist->Started = FALSE;
+   pHist->Count = 0;
+   pHist->MinUs = UINT32_MAX;
+   pHist->MaxUs = 0;
+   for (i = 0; i < ES_HISTOGRAM_BINS; i++)
+      pHist->Bins[i] = 0;
+}
+
+/****************************************************************************
+ Function
+   ES_Histogram_Print
+ Parameters
+   ES_Histogram_t * pHist : the histogram to print
+ Returns
+   None.
+ Description
+   prints the count and min/max, then the lower edge and count of every bin
+   that has anything in it
+ Notes
+   the first and last bins, which take everything outside, are printed as
+   "<" their upper edge and ">=" their lower edge
+****************************************************************************/
+void ES_Histogram_Print( ES_Histogram_t *pHist )
+{
+   int32_t Lower;
+   uint8_t i;
+
+   printf("%s period (nominal %u us): %u, min/max %u/%u us\r\n", pHist->Name,
+          pHist->NominalUs, pHist->Count, pHist->Count ? pHist->MinUs : 0,
+          pHist->MaxUs);
+   for (i = 0; i < ES_HISTOGRAM_BINS; i++) {
+      if (pHist->Bins[i] == 0)
+         continue;
+      Lower = (int32_t)pHist->NominalUs +
+              ((int32_t)i - ES_HISTOGRAM_BINS / 2) * (int32_t)pHist->BinUs;
+      if (i == 0)
+         printf("  <%d us: %u\r\n", Lower + (int32_t)pHist->BinUs, pHist->Bins[i]);
+      else if (i == ES_HISTOGRAM_BINS - 1)
+         printf("  >=%d us: %u\r\n", Lower, pHist->Bins[i]);
+      else
+         printf("  %d us: %u\r\n", Lower, pHist->Bins[i]);
+   }
+}
+
+/****************************************************************************
+ Function
+   ES_Histogram_ClearAll
+ Parameters
+   None.
+ Returns
+   None.
+ Description
+   empties every histogram set up with ES_Histogram_Init
+ Notes
+
+****************************************************************************/
+void ES_Histogram_ClearAll( void )
+{
+   uint8_t i;
+
+   for (i = 0; i < NumHistograms; i++)
+      ES_Histogram_Clear(Histograms[i]);
+}
+
+/****************************************************************************
+ Function
+   ES_Histogram_PrintAll
+ Parameters
+   None.
+ Returns
+   None.
+ Description
+   prints every histogram set up with ES_Histogram_Init
+ Notes
+   called from ES_PrintServiceStats
+****************************************************************************/
+void ES_Histogram_PrintAll( void )
+{
+   uint8_t i;
+
+   for (i = 0; i < NumHistograms; i++)
+      ES_Histogram_Print(Histograms[i]);
+}
+
+/*------------------------------- Footnotes -------------------------------*/
+/*------------------------------ End of file ------------------------------*/
@@ -0,0 +1,42 @@
+/****************************************************************************
+ Module
+     ES_Histogram.h
+ Description
+     header file for the period histograms, which record how far apart a
+     recurring event (a periodic timeout, a sensor sample) really happens
+ Notes
+     timed with the core timer, enabled with USE_PERIOD_HISTOGRAMS in
+     ES_Configure.h
+*****************************************************************************/
+#ifndef ES_Histogram_H
+#define ES_Histogram_H
+
+#include <inttypes.h>
+
+#define ES_HISTOGRAM_BINS 16
+#define ES_MAX_HISTOGRAMS 4 // how many ES_Histogram_PrintAll knows about
+
+// Bins[i] counts the periods from NominalUs + (i - ES_HISTOGRAM_BINS / 2) *
+// BinUs up to one BinUs longer. The first and last bins also take every
+// period shorter or longer than that.
+typedef struct {
+    const char *Name;
+    uint32_t NominalUs;
+    uint32_t BinUs;
+    uint32_t LastTicks; // core timer count at the last mark
+    uint8_t Started; // FALSE until the first mark
+    uint32_t Count;
+    uint32_t MinUs;
+    uint32_t MaxUs;
+    uint32_t Bins[ES_HISTOGRAM_BINS];
+} ES_Histogram_t;
+
+void ES_Histogram_Init( ES_Histogram_t *pHist, const char *Name,
+                        uint32_t NominalUs, uint32_t BinUs );
+void ES_Histogram_Mark( ES_Histogram_t *pHist );
+void ES_Histogram_Clear( ES_Histogram_t *pHist );
+void ES_Histogram_Print( ES_Histogram_t *pHist );
+void ES_Histogram_ClearAll( void );
+void ES_Histogram_PrintAll( void );
+
+#endif /* ES_Histogram_H */
@@ -0,0 +1,167 @@
+/****************************************************************************
+ Module
+     ES_Hysteresis.c
+ Description
+     Table driven hysteresis and debounce. Each engine owns a const table of
+     channels, one per analog value, and one pass of ES_Hysteresis_Update
+     takes all of their readings through the same loop, so adding a sensor
+     is one more table row rather than one more switch statement.
+ Notes
+     Update only changes the states and returns which channels changed, so
+     the caller can bring its own view of the sensors up to date before
+     ES_Hysteresis_Post sends the events. ES_Hysteresis_Run does both for
+     the callers that don't need that. Nothing here blocks or prints, so an
+     engine can be run from a periodic task.
+*****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include "ES_Configure.h"
+#include "ES_Hysteresis.h"
+#include <BOARD.h>
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+   ES_Hysteresis_Init
+ Parameters
+   ES_Hysteresis_t * pHyst : the engine to set up
+   const ES_HystChannel_t * Channels : its channel table
+   uint8_t NumChannels : how many rows the table has
+   pPostFunc PostFunc : where the enter and leave events go
+   ES_HystState_t Initial : the state every channel starts in
+ Returns
+   FALSE if there are more than ES_HYSTERESIS_MAX_CHANNELS channels, TRUE
+   otherwise
+ Description
+   ties the table to the engine and puts every channel in the start state
+ Notes
+   starting in ES_HYST_UNKNOWN gives an event on the first reading that is
+   past either level, starting in or out only when it goes the other way
+****************************************************************************/
+uint8_t ES_Hysteresis_Init( ES_Hysteresis_t *pHyst,
+                            const ES_HystChannel_t *Channels,
+                            uint8_t NumChannels, pPostFunc PostFunc,
+                            ES_HystState_t Initial )
+{
+  uint8_t i;
+
+  if ( NumChannels > ES_HYSTERESIS_MAX_CHANNELS )
+    return (FALSE);
+  pHyst->Channels = Channels;
+  pHyst->NumChannels = NumChannels;
+  pHyst->PostFunc = PostFunc;
+  for ( i = 0; i < NumChannels; i++ ) {
+    pHyst->State[i] = Initial;
+    pHyst->Count[i] = 0;
+  }
+  return (TRUE);
+}
+
+/****************************************************************************
+ Function
+   ES_Hysteresis_Update
+ Parameters
+   ES_Hysteresis_t * pHyst : the engine
+   const int16_t * Values : one reading per channel, in table order
+ Returns
+   uint32_t : bit i set if channel i changed state on this reading
+ Description
+   moves each channel towards in or out when its reading is past the level
+   for the other state, and changes the state once it has been past it for
+   Debounce readings in a row
+ Notes
+   a reading between the levels, or on the same side as the state already
+   is, starts the debounce count over
+****************************************************************************/
+uint32_t ES_Hysteresis_Update( ES_Hysteresis_t *pHyst, const int16_t *Values )
+{
+  const ES_HystChannel_t *pChan = pHyst->Channels;
+  uint32_t Changed = 0;
+  uint8_t i;
+  int16_t Value;
+  uint8_t Target;
+
+  for ( i = 0; i < pHyst->NumChannels; i++, pChan++ ) {
+    Value = Values[i];
+    if ( pChan->EnterLevel > pChan->LeaveLevel ) { // entered going up
+      Target = ( Value > pChan->EnterLevel ) ? ES_HYST_IN :
+               ( Value < pChan->LeaveLevel ) ? ES_HYST_OUT : pHyst->State[i];
+    } else { // entered going down
+      Target = ( Value < pChan->EnterLevel ) ? ES_HYST_IN :
+               ( Value > pChan->LeaveLevel ) ? ES_HYST_OUT : pHyst->State[i];
+    }
+    if ( Target == pHyst->State[i] ) {
+      pHyst->Count[i] = 0;
+      continue;
+    }
+    if ( ++pHyst->Count[i] < pChan->Debounce )
+      continue;
+    pHyst->Count[i] = 0;
+    pHyst->State[i] = Target;
+    Changed |= 1UL << i;
+  }
+  return (Changed);
+}
+
+/****************************************************************************
+ Function
+   ES_Hysteresis_Post
+ Parameters
+   ES_Hysteresis_t * pHyst : the engine
+   uint32_t Changed : channels to post for, from ES_Hysteresis_Update
+   uint32_t Payload : EventPayload of every event posted
+ Returns
+   FALSE if any post failed, TRUE otherwise
+ Description
+   posts the enter or leave event of each changed channel, lowest channel
+   first, with the channel's Param
+ Notes
+   the payload is only sent with USE_EVENT_PAYLOAD
+****************************************************************************/
+uint8_t ES_Hysteresis_Post( ES_Hysteresis_t *pHyst, uint32_t Changed,
+                            uint32_t Payload )
+{
+  ES_Event ThisEvent;
+  uint8_t ReturnVal = TRUE;
+  uint8_t i;
+
+#ifdef USE_EVENT_PAYLOAD
+  ThisEvent.EventPayload = Payload;
+#endif
+  for ( i = 0; Changed != 0; i++, Changed >>= 1 ) {
+    if ( (Changed & 1) == 0 )
+      continue;
+    ThisEvent.EventType = ( pHyst->State[i] == ES_HYST_IN ) ?
+                          pHyst->Channels[i].EnterEvent :
+                          pHyst->Channels[i].LeaveEvent;
+    ThisEvent.EventParam = pHyst->Channels[i].Param;
+    if ( pHyst->PostFunc(ThisEvent) != TRUE )
+      ReturnVal = FALSE;
+  }
+  return (ReturnVal);
+}
+
+/****************************************************************************
+ Function
+   ES_Hysteresis_Run
+ Parameters
+   ES_Hysteresis_t * pHyst : the engine
+   const int16_t * Values : one reading per channel, in table order
+   uint32_t Payload : EventPayload of every event posted
+ Returns
+   TRUE if an event was posted, FALSE otherwise
+ Description
+   ES_Hysteresis_Update then ES_Hysteresis_Post, in the form an event
+   checker or periodic task returns
+****************************************************************************/
+uint8_t ES_Hysteresis_Run( ES_Hysteresis_t *pHyst, const int16_t *Values,
+                           uint32_t Payload )
+{
+  uint32_t Changed = ES_Hysteresis_Update(pHyst, Values);
+
+  if ( Changed == 0 )
+    return (FALSE);
+  ES_Hysteresis_Post(pHyst, Changed, Payload);
+  return (TRUE);
+}
+/*------------------------------- Footnotes -------------------------------*/
+/*------------------------------ End of file ------------------------------*/
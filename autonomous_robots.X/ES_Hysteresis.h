@@ -0,0 +1,58 @@
+/****************************************************************************
+ Module
+     ES_Hysteresis.h
+ Description
+     header file for the hysteresis engine, which turns analog readings into
+     enter/leave events from a const table of thresholds instead of a hand
+     written state machine per sensor
+ Notes
+     a channel whose EnterLevel is above its LeaveLevel is entered going up
+     (trackwire strength), one whose EnterLevel is below is entered going
+     down (tape sensor difference). Both compares are strict.
+*****************************************************************************/
+#ifndef ES_Hysteresis_H
+#define ES_Hysteresis_H
+
+#include <inttypes.h>
+#include "ES_Configure.h"
+#include "ES_Events.h"
+
+#define ES_HYSTERESIS_MAX_CHANNELS 8 // per engine, the changed mask is 32 bits
+
+typedef enum {
+    ES_HYST_UNKNOWN, // between the levels since start up, no event yet
+    ES_HYST_OUT,
+    ES_HYST_IN,
+} ES_HystState_t;
+
+typedef struct {
+    int16_t EnterLevel; // goes in once the value is past this
+    int16_t LeaveLevel; // and out once it is back past this
+    uint8_t Debounce; // samples in a row past a level to change, 0 or 1 for at once
+    ES_EventTyp_t EnterEvent;
+    ES_EventTyp_t LeaveEvent;
+    uint16_t Param; // EventParam of both events
+} ES_HystChannel_t;
+
+typedef struct {
+    const ES_HystChannel_t *Channels;
+    uint8_t NumChannels;
+    pPostFunc PostFunc;
+    uint8_t State[ES_HYSTERESIS_MAX_CHANNELS]; // ES_HystState_t
+    uint8_t Count[ES_HYSTERESIS_MAX_CHANNELS]; // samples towards a change
+} ES_Hysteresis_t;
+
+uint8_t ES_Hysteresis_Init( ES_Hysteresis_t *pHyst,
+                            const ES_HystChannel_t *Channels,
+                            uint8_t NumChannels, pPostFunc PostFunc,
+                            ES_HystState_t Initial );
+uint32_t ES_Hysteresis_Update( ES_Hysteresis_t *pHyst, const int16_t *Values );
+uint8_t ES_Hysteresis_Post( ES_Hysteresis_t *pHyst, uint32_t Changed,
+                            uint32_t Payload );
+uint8_t ES_Hysteresis_Run( ES_Hysteresis_t *pHyst, const int16_t *Values,
+                           uint32_t Payload );
+
+#define ES_Hysteresis_GetState(pHyst, Channel) \
+    ((ES_HystState_t) (pHyst)->State[(Channel)])
+
+#endif /* ES_Hysteresis_H */
@@ -0,0 +1,133 @@
+/****************************************************************************
+ Module
+     ES_ISRQueue.c
+ Description
+     Implements the lock free single producer/single consumer event rings
+     that interrupt handlers post into. ES_Run empties them into the service
+     queues, so the service queues are only ever touched from the main loop.
+ Notes
+     The size of each ring must be a power of two no larger than 128. There
+     is no modulo and no interrupt masking on either side: the producer only
+     writes Head and the consumer only writes Tail, each after the entry it
+     covers has been written or read.
+*****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include "ES_Configure.h"
+#include "ES_ISRQueue.h"
+#include <BOARD.h>
+
+/*----------------------------- Module Defines ----------------------------*/
+#define MAX_RING_SIZE 128 // largest size the uint8_t indices can tell from empty
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+   ES_ISRQueue_Init
+ Parameters
+   ES_ISRQueue_t * pQueue : the ring to set up
+   ES_ISRQueueEntry_t * pEntries : storage for the ring's entries
+   uint8_t Size : number of entries in pEntries, a power of two
+ Returns
+   uint8_t : FALSE if Size is not a power of two between 1 and 128
+ Description
+   empties the ring and attaches its storage
+ Notes
+   call before the interrupts that post into the ring are enabled
+****************************************************************************/
+uint8_t ES_ISRQueue_Init( ES_ISRQueue_t *pQueue, ES_ISRQueueEntry_t *pEntries,
+                          uint8_t Size )
+{
+   if ((Size == 0) || (Size > MAX_RING_SIZE) || ((Size & (Size - 1)) != 0))
+      return FALSE;
+   pQueue->pEntries = pEntries;
+   pQueue->Mask = Size - 1;
+   pQueue->Head = 0;
+   pQueue->Tail = 0;
+   pQueue->Overflows = 0;
+   return TRUE;
+}
+
+/****************************************************************************
+ Function
+   ES_ISRQueue_Put
+ Parameters
+   ES_ISRQueue_t * pQueue : the ring to add to
+   uint8_t Service : the service the event is for
+   ES_Event Event2Add : event to be added to the ring
+ Returns
+   uint8_t : TRUE if the add was successful, FALSE if the ring was full
+ Description
+   producer side, called from the interrupt handlers at one priority level
+ Notes
+   the entry is written before Head is advanced, so the consumer never sees
+   a half written entry
+****************************************************************************/
+uint8_t ES_ISRQueue_Put( ES_ISRQueue_t *pQueue, uint8_t Service,
+                         ES_Event Event2Add )
+{
+   uint8_t Head = pQueue->Head;
+   ES_ISRQueueEntry_t *pEntry;
+
+   if ((uint8_t)(Head - pQueue->Tail) > pQueue->Mask) {
+      pQueue->Overflows++;
+      return FALSE;
+   }
+   pEntry = &pQueue->pEntries[Head & pQueue->Mask];
+   pEntry->Event = Event2Add;
+   pEntry->Service = Service;
+   ES_ISRQueueBarrier(); // entry must be in memory before it is published
+   pQueue->Head = Head + 1;
+   return TRUE;
+}
+
+/****************************************************************************
+ Function
+   ES_ISRQueue_Get
+ Parameters
+   ES_ISRQueue_t * pQueue : the ring to take from
+   uint8_t * pService : returns the service the event is for
+   ES_Event * pReturnEvent : returns the event
+ Returns
+   uint8_t : FALSE if the ring was empty
+ Description
+   consumer side, called from ES_Run
+ Notes
+   the entry is read before Tail is advanced, so the producer can't reuse
+   the slot while it is still being copied
+****************************************************************************/
+uint8_t ES_ISRQueue_Get( ES_ISRQueue_t *pQueue, uint8_t *pService,
+                         ES_Event *pReturnEvent )
+{
+   uint8_t Tail = pQueue->Tail;
+   ES_ISRQueueEntry_t *pEntry;
+
+   if (Tail == pQueue->Head)
+      return FALSE;
+   ES_ISRQueueBarrier(); // don't read the entry before seeing Head move
+   pEntry = &pQueue->pEntries[Tail & pQueue->Mask];
+   *pReturnEvent = pEntry->Event;
+   *pService = pEntry->Service;
+   ES_ISRQueueBarrier(); // finish with the slot before handing it back
+   pQueue->Tail = Tail + 1;
+   return TRUE;
+}
+
+/****************************************************************************
+ Function
+   ES_ISRQueue_IsEmpty
+ Parameters
+   ES_ISRQueue_t * pQueue : the ring to test
+ Returns
+   uint8_t : TRUE if the ring is empty
+ Description
+   see above
+ Notes
+
+****************************************************************************/
+uint8_t ES_ISRQueue_IsEmpty( ES_ISRQueue_t *pQueue )
+{
+   return (pQueue->Head == pQueue->Tail);
+}
+
+/*------------------------------- Footnotes -------------------------------*/
+/*------------------------------ End of file ------------------------------*/
@@ -0,0 +1,47 @@
+/****************************************************************************
+ Module
+     ES_ISRQueue.h
+ Description
+     header file for the single producer/single consumer event rings that
+     carry events posted from interrupt handlers to the framework
+ Notes
+     one ring per interrupt priority level that posts events, see
+     ES_ISR_QUEUE_LIST in ES_Configure.h
+*****************************************************************************/
+#ifndef ES_ISRQueue_H
+#define ES_ISRQueue_H
+
+#include "ES_Events.h"
+#include <inttypes.h>
+
+// stops the compiler from moving memory accesses across this point. The
+// M4K core is single issue and in order, so nothing more is needed to make
+// the ring contents visible before the index that publishes them.
+#define ES_ISRQueueBarrier()  __asm__ __volatile__("" ::: "memory")
+
+typedef struct {
+    ES_Event Event;
+    uint8_t Service; // index of the service the event is posted to
+} ES_ISRQueueEntry_t;
+
+// Head and Tail run freely from 0 to 255 and wrap; Head - Tail is the number
+// of entries in the ring, and Mask (Size - 1) turns them into slot numbers.
+// Head is only written by the producer (the ISRs at one priority level),
+// Tail only by the consumer (ES_Run).
+typedef struct {
+    ES_ISRQueueEntry_t *pEntries;
+    volatile uint8_t Head;
+    volatile uint8_t Tail;
+    uint8_t Mask;
+    uint32_t Overflows; // posts dropped because the ring was full
+} ES_ISRQueue_t;
+
+uint8_t ES_ISRQueue_Init( ES_ISRQueue_t *pQueue, ES_ISRQueueEntry_t *pEntries,
+                          uint8_t Size );
+uint8_t ES_ISRQueue_Put( ES_ISRQueue_t *pQueue, uint8_t Service,
+                         ES_Event Event2Add );
+uint8_t ES_ISRQueue_Get( ES_ISRQueue_t *pQueue, uint8_t *pService,
+                         ES_Event *pReturnEvent );
+uint8_t ES_ISRQueue_IsEmpty( ES_ISRQueue_t *pQueue );
+
+#endif /* ES_ISRQueue_H */
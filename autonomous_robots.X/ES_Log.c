@@ -0,0 +1,206 @@
+/****************************************************************************
+ Module
+     ES_Log.c
+ Description
+     Deferred log. ES_Log_Put copies a message number and its arguments into
+     a ring in a few instructions, and the Log service turns them into text
+     with printf later. The service only starts printing when the transmit
+     buffer is empty and stops while there is still room for the longest
+     message, so printf never finds the buffer full and nothing is dropped
+     or waited for. When the buffer is still busy it looks again after
+     ES_LOG_RETRY_TIME.
+ Notes
+     any interrupt level may put messages, so the ring is written with
+     interrupts off. It is only read by the Log service. A message that
+     finds the ring full is counted and reported when there is room again.
+     Without USE_DEFERRED_LOG, ES_Log_Put prints straight away.
+*****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "ES_Log.h"
+#include "serial.h"
+#include <stdio.h>
+#include <xc.h>
+#include <BOARD.h>
+
+/*----------------------------- Module Defines ----------------------------*/
+#define ES_LOG_RETRY_TIME 2 // ms, about 23 characters at 115200 baud
+#define LOG_FORMAT_STRING(Id, Format) Format,
+
+/*------------------------------ Module Types -----------------------------*/
+typedef struct {
+    uint8_t Id; // ES_LogId_t
+    uint32_t Args[ES_LOG_MAX_ARGS];
+} ES_LogRecord_t;
+
+/*---------------------------- Module Variables ---------------------------*/
+static const char * const LogFormats[] = {
+    ES_LOG_FORMAT_LIST(LOG_FORMAT_STRING)
+};
+
+#ifdef USE_DEFERRED_LOG
+#if (ES_LOG_RING_SIZE & (ES_LOG_RING_SIZE - 1)) || (ES_LOG_RING_SIZE > 128)
+#error ES_LOG_RING_SIZE must be a power of two up to 128
+#endif
+static ES_LogRecord_t Ring[ES_LOG_RING_SIZE];
+// run freely and wrap, Head - Tail is the number of messages waiting. Head
+// is only written with interrupts off, Tail only by the Log service.
+static volatile uint8_t Head;
+static volatile uint8_t Tail;
+static uint8_t Started = FALSE;
+#endif
+static uint32_t Dropped;
+static uint32_t Reported; // Dropped when it was last printed
+static uint8_t MyPriority;
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+   ES_Log_Put
+ Parameters
+   ES_LogId_t Id : which message, from ES_LOG_FORMAT_LIST
+   uint32_t Arg0 to Arg4 : its arguments, the unused ones are ignored
+ Returns
+   None.
+ Description
+   queues the message for the Log service, and wakes it up if it had
+   nothing to do
+ Notes
+   called through the ES_LOGn macros
+****************************************************************************/
+void ES_Log_Put( ES_LogId_t Id, uint32_t Arg0, uint32_t Arg1, uint32_t Arg2,
+                 uint32_t Arg3, uint32_t Arg4 )
+{
+#ifdef USE_DEFERRED_LOG
+  unsigned int SavedStatus;
+  ES_LogRecord_t *pRecord;
+  uint8_t WasEmpty;
+
+  SavedStatus = __builtin_disable_interrupts();
+  if ( (uint8_t)(Head - Tail) >= ES_LOG_RING_SIZE ) {
+    Dropped++;
+    __builtin_mtc0(_CP0_STATUS, _CP0_STATUS_SELECT, SavedStatus);
+    return;
+  }
+  WasEmpty = ( Head == Tail );
+  pRecord = &Ring[Head & (ES_LOG_RING_SIZE - 1)];
+  pRecord->Id = Id;
+  pRecord->Args[0] = Arg0;
+  pRecord->Args[1] = Arg1;
+  pRecord->Args[2] = Arg2;
+  pRecord->Args[3] = Arg3;
+  pRecord->Args[4] = Arg4;
+  Head++;
+  __builtin_mtc0(_CP0_STATUS, _CP0_STATUS_SELECT, SavedStatus);
+  if ( WasEmpty && Started ) {
+    ES_Event ThisEvent = { ES_LOG_PENDING, 0 };
+    PostLogService(ThisEvent);
+  }
+#else
+  printf(LogFormats[Id], Arg0, Arg1, Arg2, Arg3, Arg4);
+#endif
+}
+
+/****************************************************************************
+ Function
+   ES_Log_GetDropped
+ Parameters
+   None.
+ Returns
+   uint32_t : how many messages have been lost to a full ring since start up
+****************************************************************************/
+uint32_t ES_Log_GetDropped( void )
+{
+  return (Dropped);
+}
+
+/****************************************************************************
+ Function
+   InitLogService
+ Parameters
+   uint8_t : the priority of this service
+ Returns
+   uint8_t : FALSE if the first event could not be posted, TRUE otherwise
+ Description
+   starts taking the messages out of the ring, including any put there by
+   the init functions that ran before this one
+****************************************************************************/
+uint8_t InitLogService( uint8_t Priority )
+{
+  ES_Event ThisEvent = { ES_LOG_PENDING, 0 };
+
+  MyPriority = Priority;
+#ifdef USE_DEFERRED_LOG
+  Started = TRUE;
+#endif
+  return PostLogService(ThisEvent);
+}
+
+/****************************************************************************
+ Function
+   PostLogService
+ Parameters
+   ES_Event : the event to post
+ Returns
+   uint8_t : FALSE if the post failed, TRUE otherwise
+****************************************************************************/
+uint8_t PostLogService( ES_Event ThisEvent )
+{
+  return ES_PostToService(MyPriority, ThisEvent);
+}
+
+/****************************************************************************
+ Function
+   RunLogService
+ Parameters
+   ES_Event : ES_LOG_PENDING, the ES_TIMEOUT of LOG_TIMER, or a published
+              event the service subscribes to
+ Returns
+   ES_Event : ES_NO_EVENT
+ Description
+   prints the waiting messages while the transmit buffer has room for the
+   longest one, ES_LOG_MAX_CHARS, and looks again after ES_LOG_RETRY_TIME
+   while there are more. Any other event is logged, and
+   printed with the rest.
+ Notes
+   a message is read out of the ring before Tail moves on, so a put from an
+   interrupt can never write over it while it is printed
+****************************************************************************/
+ES_Event RunLogService( ES_Event ThisEvent )
+{
+  ES_Event ReturnEvent = { ES_NO_EVENT, 0 };
+#ifdef USE_DEFERRED_LOG
+  ES_LogRecord_t Record;
+  uint32_t Lost;
+
+  if ( (ThisEvent.EventType != ES_LOG_PENDING) &&
+       (ThisEvent.EventType != ES_TIMEOUT) ) {
+    if ( ThisEvent.EventType < ARRAY_SIZE(EventNames) )
+      ES_LOG2(LOG_EVENT, EventNames[ThisEvent.EventType], ThisEvent.EventParam);
+    return (ReturnEvent);
+  }
+  if ( SERIAL_GetTxFree() < ES_LOG_MAX_CHARS ) {
+    ES_Timer_InitTimer(LOG_TIMER, ES_LOG_RETRY_TIME);
+    return (ReturnEvent);
+  }
+  Lost = Dropped;
+  if ( Lost != Reported ) {
+    printf(LogFormats[LOG_DROPPED], Lost - Reported);
+    Reported = Lost;
+  }
+  while ( (Head != Tail) && (SERIAL_GetTxFree() >= ES_LOG_MAX_CHARS) ) {
+    Record = Ring[Tail & (ES_LOG_RING_SIZE - 1)];
+    ES_ISRQueueBarrier();
+    Tail++;
+    if ( Record.Id < NUM_LOG_FORMATS )
+      printf(LogFormats[Record.Id], Record.Args[0], Record.Args[1],
+             Record.Args[2], Record.Args[3], Record.Args[4]);
+  }
+  if ( Head != Tail )
+    ES_Timer_InitTimer(LOG_TIMER, ES_LOG_RETRY_TIME);
+#endif
+  return (ReturnEvent);
+}
+/*------------------------------- Footnotes -------------------------------*/
+/*------------------------------ End of file ------------------------------*/
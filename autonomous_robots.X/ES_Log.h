@@ -0,0 +1,52 @@
+/****************************************************************************
+ Module
+     ES_Log.h
+ Description
+     header file for the deferred log. ES_LOGn(Id, ...) stands in for a
+     printf: with USE_DEFERRED_LOG it only stores the message number and its
+     arguments, and the Log service prints them later, when the UART is idle.
+ Notes
+     the messages are listed in ES_LOG_FORMAT_LIST in ES_Configure.h. Safe to
+     call from any interrupt, and from the init functions before the Log
+     service has started.
+*****************************************************************************/
+#ifndef ES_Log_H
+#define ES_Log_H
+
+#include <inttypes.h>
+#include "ES_Configure.h"
+#include "ES_Events.h"
+
+#define ES_LOG_MAX_ARGS 5
+// longest printed message. The Log service only prints while the transmit
+// buffer has this much room (SERIAL_GetTxFree), so a message is never cut
+// short.
+#define ES_LOG_MAX_CHARS 256
+
+#define LOG_FORMAT_ID(Id, Format) Id,
+
+typedef enum {
+    ES_LOG_FORMAT_LIST(LOG_FORMAT_ID)
+    NUM_LOG_FORMATS
+} ES_LogId_t;
+
+#define ES_LOG0(Id) ES_Log_Put((Id), 0, 0, 0, 0, 0)
+#define ES_LOG1(Id, a) ES_Log_Put((Id), (uint32_t) (a), 0, 0, 0, 0)
+#define ES_LOG2(Id, a, b) ES_Log_Put((Id), (uint32_t) (a), (uint32_t) (b), 0, 0, 0)
+#define ES_LOG3(Id, a, b, c) \
+    ES_Log_Put((Id), (uint32_t) (a), (uint32_t) (b), (uint32_t) (c), 0, 0)
+#define ES_LOG4(Id, a, b, c, d) \
+    ES_Log_Put((Id), (uint32_t) (a), (uint32_t) (b), (uint32_t) (c), (uint32_t) (d), 0)
+#define ES_LOG5(Id, a, b, c, d, e) \
+    ES_Log_Put((Id), (uint32_t) (a), (uint32_t) (b), (uint32_t) (c), (uint32_t) (d), (uint32_t) (e))
+
+void ES_Log_Put( ES_LogId_t Id, uint32_t Arg0, uint32_t Arg1, uint32_t Arg2,
+                 uint32_t Arg3, uint32_t Arg4 );
+uint32_t ES_Log_GetDropped( void );
+
+// the Log service, the lowest priority one in SERVICE_LIST
+uint8_t InitLogService( uint8_t Priority );
+uint8_t PostLogService( ES_Event ThisEvent );
+ES_Event RunLogService( ES_Event ThisEvent );
+
+#endif /* ES_Log_H */
@@ -0,0 +1,126 @@
+/****************************************************************************
+ Module
+     ES_PeriodicTasks.c
+
+ Description
+     Time triggered task table. The fixed rate sampling jobs (bumper
+     debounce, tape sensor cycle, trackwire) are plain functions listed with
+     their period in ES_PERIODIC_TASK_LIST. One high resolution timer gives
+     the task tick and runs the ones that are due straight from the high
+     resolution timer code, so no timeout goes through a service queue just
+     to take a sample. A task posts a framework event only when what it
+     watches has changed.
+
+ Notes
+     Tasks have the same prototype as the event checkers and return TRUE
+     when they posted something. They are not only run from the Timer5
+     interrupt: every ES_HRTimer_* call locks the timers and brings them up
+     to date (LockHRTimers, CatchUpHRTimers, AdvanceHRTimers), and a tick
+     that has come due is run right there. So a task can also run inside
+     the beacon edge interrupt or in main context, from a state machine that
+     starts or stops a high resolution timer. In every case the CPU priority
+     is at least 4 and the posts go through an ISR ring, so tasks must be
+     short and must not call printf. They are run in rate monotonic order, shortest period first,
+     whatever order they are listed in, so a slow task can't hold up a
+     faster one that is due in the same tick.
+ ****************************************************************************/
+
+/*----------------------------- Include Files -----------------------------*/
+
+#include <BOARD.h>
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "ES_ServiceHeaders.h"
+#include "ES_PeriodicTasks.h"
+#include EVENT_CHECK_HEADER
+
+#ifdef USE_PERIODIC_TASKS
+#ifndef USE_HR_TIMERS
+#error USE_PERIODIC_TASKS needs USE_HR_TIMERS for the task tick
+#endif
+
+/*----------------------------- Module Defines ----------------------------*/
+#define TASK_ENTRY(Func, Period) {Func, Period},
+
+/*------------------------------ Module Types -----------------------------*/
+typedef struct {
+    CheckFunc *Func;
+    uint16_t Period; // in task ticks
+} ES_PeriodicTask_t;
+
+/*---------------------------- Module Variables ---------------------------*/
+static const ES_PeriodicTask_t TaskTable[] = {
+    ES_PERIODIC_TASK_LIST(TASK_ENTRY)
+};
+
+#define NUM_TASKS ARRAY_SIZE(TaskTable)
+
+// the tasks in the order they are run, shortest period first
+static uint8_t TaskOrder[NUM_TASKS];
+// task ticks until each task is next due, by table index
+static uint16_t TaskCountdown[NUM_TASKS];
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+     ES_PeriodicTask_Init
+ Parameters
+     None.
+ Returns
+     uint8_t : FALSE if a task has no function or a period of 0, or the task
+     tick timer could not be started
+ Description
+     sorts the table into rate monotonic order, makes every task due on the
+     first tick and starts the task tick
+ Notes
+     the sort is stable, so tasks with the same period run in list order
+ ****************************************************************************/
+uint8_t ES_PeriodicTask_Init(void) {
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < NUM_TASKS; i++) {
+        if ((TaskTable[i].Func == (CheckFunc *) 0) || (TaskTable[i].Period == 0)) {
+            return FALSE;
+        }
+        // insertion sort by period, the table is only a few entries long
+        for (j = i; (j > 0) && (TaskTable[TaskOrder[j - 1]].Period > TaskTable[i].Period); j--) {
+            TaskOrder[j] = TaskOrder[j - 1];
+        }
+        TaskOrder[j] = i;
+        TaskCountdown[i] = 1;
+    }
+    return (ES_HRTimer_InitPeriodicTimer(PERIODIC_TASK_HR_TIMER, ES_TASK_TICK) == ES_Timer_OK);
+}
+
+/****************************************************************************
+ Function
+     ES_PeriodicTask_Run
+ Parameters
+     ES_Event ThisEvent : the task tick, not used
+ Returns
+     uint8_t : TRUE
+ Description
+     counts down every task and runs the ones that have come due, in
+     rate monotonic order
+ Notes
+     runs wherever the HR timers are brought up to date, see the notes at
+     the top. A tick that came too late is skipped by the HR timer,
+     and the tasks just run one tick late.
+ ****************************************************************************/
+uint8_t ES_PeriodicTask_Run(ES_Event ThisEvent) {
+    uint8_t i;
+    uint8_t Index;
+
+    for (i = 0; i < NUM_TASKS; i++) {
+        Index = TaskOrder[i];
+        if (--TaskCountdown[Index] == 0) {
+            TaskCountdown[Index] = TaskTable[Index].Period;
+            TaskTable[Index].Func();
+        }
+    }
+    return TRUE;
+}
+#endif
+/*------------------------------- Footnotes -------------------------------*/
+/*------------------------------ End of file ------------------------------*/
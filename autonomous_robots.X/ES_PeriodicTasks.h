@@ -0,0 +1,48 @@
+/****************************************************************************
+ Module
+         ES_PeriodicTasks.h
+
+ Description
+         Header File for the time triggered task table, the fixed rate
+         sampling functions that run straight from the high resolution timer
+         code instead of through a service queue
+
+ Notes
+         enabled with USE_PERIODIC_TASKS in ES_Configure.h, where the tasks
+         are listed in ES_PERIODIC_TASK_LIST. Needs USE_HR_TIMERS.
+
+****************************************************************************/
+
+#ifndef ES_PeriodicTasks_H
+#define ES_PeriodicTasks_H
+
+#include <inttypes.h>
+#include "ES_Configure.h"
+#include "ES_Events.h"
+#include "ES_HRTimers.h"
+
+#ifdef USE_PERIODIC_TASKS
+#define ES_TASK_TICK_US (ES_TASK_TICK * ES_HR_TICK_US) // length of one task tick
+
+/**
+ * @Function ES_PeriodicTask_Init(void)
+ * @param none
+ * @return FALSE if the task tick timer could not be started, else TRUE
+ * @brief  orders the tasks by period and starts the task tick. Called from
+ *         ES_Initialize once the services are set up, so no task runs
+ *         before the state it works on has been initialized. */
+uint8_t ES_PeriodicTask_Init(void);
+
+/**
+ * @Function ES_PeriodicTask_Run(ES_Event ThisEvent)
+ * @param ThisEvent - the ES_HR_TIMEOUT of the task tick timer
+ * @return TRUE
+ * @brief  runs every task that is due this tick, the one with the shortest
+ *         period first. Not for calling directly, it is the post function
+ *         of PERIODIC_TASK_HR_TIMER, so it runs in the Timer5 interrupt or
+ *         in any caller of the ES_HRTimer_* functions, at priority 4. */
+uint8_t ES_PeriodicTask_Run(ES_Event ThisEvent);
+#endif
+
+#endif   /* ES_PeriodicTasks_H */
+/*------------------------------ End of file ------------------------------*/
@@ -22,13 +22,19 @@
 // CurrentIndex is the 'read-from' index,
 // actually CurrentIndex + sizeof(EF_Queue_t)
 // entries are made to CurrentIndex + NumEntries + sizeof(ES_Queue_t)
+// Mask is QueueSize - 1, QueueSize is always a power of two
 typedef struct {  unsigned char QueueSize;
                   unsigned char CurrentIndex;
                   unsigned char NumEntries;
+                  unsigned char Mask;
 } ES_Queue_t;
 
 typedef ES_Queue_t * pQueue_t;
 
+// wraps CurrentIndex plus an offset back into 0 to QueueSize-1, in place of
+// the % QueueSize that needs a divide on the PIC32
+#define WrapIndex(pThisQueue, Index) ((unsigned char)((Index) & (pThisQueue)->Mask))
+
 /*---------------------------- Module Functions ---------------------------*/
 
 /*---------------------------- Module Variables ---------------------------*/
@@ -50,6 +56,11 @@ typedef ES_Queue_t * pQueue_t;
    ES_Event (at 4 bytes; 2 enum, 2 param) is greater than the 
    sizeof(ES_Queue_t), you only need to declare an array of ES_Event
    with 1 more element than you need for the actual queue.
+   The number of entries must be a power of two, so the queue can wrap its
+   indices with a mask. Check it where the block is declared with
+   ES_QUEUE_SIZE_CHECK. Any other size is rounded down to the largest power
+   of two that fits, so an old ES_Event q[10] still works as an 8 entry
+   queue.
  Author
    J. Edward Carryer, 08/09/11, 18:40
 ****************************************************************************/
@@ -60,6 +71,11 @@ uint8_t ES_InitQueue( ES_Event * pBlock, unsigned char BlockSize )
    pThisQueue = (pQueue_t)pBlock;
    // use all but the structure overhead as the Queue
    pThisQueue->QueueSize = BlockSize - 1;
+   // clear low set bits until only the top one is left
+   while (!ES_QUEUE_SIZE_OK(pThisQueue->QueueSize) &&
+         (pThisQueue->QueueSize != 0))
+      pThisQueue->QueueSize &= pThisQueue->QueueSize - 1;
+   pThisQueue->Mask = pThisQueue->QueueSize - 1;
    pThisQueue->CurrentIndex = 0;
    pThisQueue->NumEntries = 0;
    return(pThisQueue->QueueSize);
@@ -86,12 +102,12 @@ uint8_t ES_EnQueueFIFO( ES_Event * pBlock, ES_Event Event2Add )
    pThisQueue = (pQueue_t)pBlock;
    // index will go from 0 to QueueSize-1 so use '<'
    if ( pThisQueue->NumEntries < pThisQueue->QueueSize)
-   {  // save the new event, use % to create circular buffer in block
-      // 1+ to step past the Queue struct at the beginning of the
+   {  // save the new event, wrap the index to create circular buffer in
+      // block, 1+ to step past the Queue struct at the beginning of the
       // block
       //EnterCritical();   // save interrupt state, turn ints off
-      pBlock[ 1 + ((pThisQueue->CurrentIndex + pThisQueue->NumEntries)
-               % pThisQueue->QueueSize)] = Event2Add;
+      pBlock[ 1 + WrapIndex(pThisQueue, pThisQueue->CurrentIndex +
+               pThisQueue->NumEntries)] = Event2Add;
       pThisQueue->NumEntries++;          // inc number of entries
       //ExitCritical();  // restore saved interrupt state
       
@@ -101,6 +117,41 @@ uint8_t ES_EnQueueFIFO( ES_Event * pBlock, ES_Event Event2Add )
 }
 
 
+/****************************************************************************
+ Function
+   ES_EnQueueLIFO
+ Parameters
+   ES_Event * pBlock : pointer to the block of memory in use as the Queue
+   ES_Event Event2Add : event to be added to the Queue
+ Returns
+   uint8_t : TRUE if the add was successful, FALSE if not
+ Description
+   if it will fit, adds Event2Add to the front of the Queue, so that it is
+   the next event to be pulled out
+ Notes
+   used to recall deferred events ahead of anything already queued
+****************************************************************************/
+uint8_t ES_EnQueueLIFO( ES_Event * pBlock, ES_Event Event2Add )
+{
+   pQueue_t pThisQueue;
+   pThisQueue = (pQueue_t)pBlock;
+   if ( pThisQueue->NumEntries < pThisQueue->QueueSize)
+   {
+      EnterCritical();   // save interrupt state, turn ints off
+      // step the read index back one entry, wrapping at the start
+      if (pThisQueue->CurrentIndex == 0)
+         pThisQueue->CurrentIndex = pThisQueue->QueueSize - 1;
+      else
+         pThisQueue->CurrentIndex--;
+      pBlock[ 1 + pThisQueue->CurrentIndex ] = Event2Add;
+      pThisQueue->NumEntries++;          // inc number of entries
+      ExitCritical();  // restore saved interrupt state
+
+      return(TRUE);
+   }else
+      return(FALSE);
+}
+
 /****************************************************************************
  Function
    ES_DeQueue
@@ -128,10 +179,8 @@ uint8_t ES_DeQueue( ES_Event * pBlock, ES_Event * pReturnEvent )
       EnterCritical();   // save interrupt state, turn ints off
       *pReturnEvent = pBlock[ 1 + pThisQueue->CurrentIndex ];
       // inc the index
-      pThisQueue->CurrentIndex++;
-      // this way we only do the modulo operation when we really need to
-      if (pThisQueue->CurrentIndex >=  pThisQueue->QueueSize)
-         pThisQueue->CurrentIndex = (unsigned char)(pThisQueue->CurrentIndex % pThisQueue->QueueSize);
+      pThisQueue->CurrentIndex = WrapIndex(pThisQueue,
+               pThisQueue->CurrentIndex + 1);
       //dec number of elements since we took 1 out
       NumLeft = --pThisQueue->NumEntries; 
       ExitCritical();  // restore saved interrupt state
@@ -143,6 +192,41 @@ uint8_t ES_DeQueue( ES_Event * pBlock, ES_Event * pReturnEvent )
    return NumLeft;
 }
 
+/****************************************************************************
+ Function
+   ES_DeQueueNewest
+ Parameters
+   ES_Event * pBlock : pointer to the block of memory in use as the Queue
+   ES_Event * pReturnEvent : used to return the event pulled from the queue
+ Returns
+   The number of entries remaining in the Queue
+ Description
+   pulls the most recently added entry from the Queue, ES_NO_EVENT if the
+   Queue was empty, and copies it to *pReturnEvent
+ Notes
+   the counterpart of ES_DeQueue for emptying a queue newest first
+****************************************************************************/
+uint8_t ES_DeQueueNewest( ES_Event * pBlock, ES_Event * pReturnEvent )
+{
+   pQueue_t pThisQueue;
+   uint8_t NumLeft;
+
+   pThisQueue = (pQueue_t)pBlock;
+   if ( pThisQueue->NumEntries > 0)
+   {
+      EnterCritical();   // save interrupt state, turn ints off
+      *pReturnEvent = pBlock[ 1 + WrapIndex(pThisQueue,
+               pThisQueue->CurrentIndex + pThisQueue->NumEntries - 1)];
+      NumLeft = --pThisQueue->NumEntries;
+      ExitCritical();  // restore saved interrupt state
+   }else { // no items left in the queue
+      (*pReturnEvent).EventType = ES_NO_EVENT;
+      (*pReturnEvent).EventParam = 0;
+      NumLeft = 0;
+   }
+   return NumLeft;
+}
+
 /****************************************************************************
  Function
    ES_IsQueueEmpty
@@ -165,6 +249,62 @@ uint8_t ES_IsQueueEmpty( ES_Event * pBlock )
    return(pThisQueue->NumEntries == 0);
 }
 
+/****************************************************************************
+ Function
+   ES_CoalesceInQueue
+ Parameters
+   ES_Event * pBlock : pointer to the block of memory in use as the Queue
+   ES_Event Event2Add : event about to be added to the Queue
+   uint8_t ReplaceParam : TRUE to overwrite the parameter of a pending event
+ Returns
+   uint8_t : TRUE if Event2Add was merged into a pending event, FALSE if it
+   still needs to be added to the Queue
+ Description
+   looks for the most recently queued event of the same type as Event2Add.
+   With ReplaceParam that event takes the new parameter (only the latest value
+   is kept), otherwise Event2Add is only merged if the parameters match.
+ Notes
+   only the newest pending event of the type is compared, so a sequence like
+   A(1), A(2), A(1) is not reordered or collapsed. With ReplaceParam it must
+   also be the newest event in the Queue: A(1), B, A(2) stays as it is, so a
+   new value never jumps ahead of an event that was posted before it.
+****************************************************************************/
+uint8_t ES_CoalesceInQueue( ES_Event * pBlock, ES_Event Event2Add,
+                            uint8_t ReplaceParam )
+{
+   pQueue_t pThisQueue;
+   unsigned char Index;
+   unsigned char Count;
+   uint8_t Merged = FALSE;
+
+   pThisQueue = (pQueue_t)pBlock;
+   EnterCritical();   // save interrupt state, turn ints off
+   // walk back from the newest entry to the oldest
+   for (Count = pThisQueue->NumEntries; Count > 0; Count--)
+   {
+      Index = 1 + WrapIndex(pThisQueue, pThisQueue->CurrentIndex + Count - 1);
+      if (pBlock[Index].EventType == Event2Add.EventType)
+      {
+         if (ReplaceParam == TRUE)
+         {
+            pBlock[Index].EventParam = Event2Add.EventParam;
+#ifdef USE_EVENT_PAYLOAD
+            pBlock[Index].EventPayload = Event2Add.EventPayload;
+#endif
+            Merged = TRUE;
+         }else if (pBlock[Index].EventParam == Event2Add.EventParam)
+         {
+            Merged = TRUE;
+         }
+         break;
+      }
+      if (ReplaceParam == TRUE)
+         break; // the newest event is another type
+   }
+   ExitCritical();  // restore saved interrupt state
+   return Merged;
+}
+
 #if 0
 /****************************************************************************
  Function
@@ -196,7 +336,6 @@ void QueueFlushQueue( unsigned char * pBlock )
 /***************************************************************************
  private functions
  ***************************************************************************/
-
 /*------------------------------- Footnotes -------------------------------*/
 /*------------------------------ End of file ------------------------------*/
 
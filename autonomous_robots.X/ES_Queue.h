@@ -19,11 +19,23 @@
 
 #include "ES_Events.h"
 #include <inttypes.h>
+
+// a queue holds a power of two number of events, so its indices wrap with a
+// mask. ES_QUEUE_SIZE_CHECK(Name, Size) fails to compile for any other size;
+// ES_InitQueue rounds a block of any other size down to a power of two.
+#define ES_QUEUE_SIZE_OK(Size) (((Size) > 0) && (((Size) & ((Size) - 1)) == 0))
+#define ES_QUEUE_SIZE_CHECK(Name, Size) \
+    typedef char Name##_QueueSizeCheck[ES_QUEUE_SIZE_OK(Size) ? 1 : -1]
+
 /* prototypes for public functions */
 
 uint8_t ES_InitQueue( ES_Event * pBlock, unsigned char BlockSize );
 uint8_t ES_EnQueueFIFO( ES_Event * pBlock, ES_Event Event2Add );
+uint8_t ES_EnQueueLIFO( ES_Event * pBlock, ES_Event Event2Add );
 uint8_t ES_DeQueue( ES_Event * pBlock, ES_Event * pReturnEvent );
+uint8_t ES_DeQueueNewest( ES_Event * pBlock, ES_Event * pReturnEvent );
+uint8_t ES_CoalesceInQueue( ES_Event * pBlock, ES_Event Event2Add,
+                            uint8_t ReplaceParam );
 //void EF_FlushQueue( unsigned char * pBlock );
 uint8_t ES_IsQueueEmpty( ES_Event * pBlock );
 
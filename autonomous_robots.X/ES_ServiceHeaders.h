@@ -12,34 +12,13 @@
 
 #include "ES_Configure.h"
 
-#include SERV_0_HEADER
-
-#if NUM_SERVICES > 1
-#include SERV_1_HEADER
-#endif
-
-
-#if NUM_SERVICES > 2
-#include SERV_2_HEADER
-#endif
-
-#if NUM_SERVICES > 3
-#include SERV_3_HEADER
-#endif
-
-#if NUM_SERVICES > 4
-#include SERV_4_HEADER
-#endif
-
-#if NUM_SERVICES > 5
-#include SERV_5_HEADER
-#endif
-
-#if NUM_SERVICES > 6
-#include SERV_6_HEADER
-#endif
-
-#if NUM_SERVICES > 7
-#include SERV_7_HEADER
-#endif
-
+// the header files with the public function prototypes for each of the
+// services in SERVICE_LIST in ES_Configure.h, one per entry in the same
+// order. Keep the two in step: an entry without its header here leaves the
+// framework's service table calling undeclared functions.
+#include "ES_Log.h"                      // Log
+#include "tape_detector_fsm_service.h"   // TapeDetector
+#include "bumper_service.h"              // Bumper
+#include "TopHSM.h"                      // TopHSM
+// and the modules that own a high resolution timer post function
+#include "beacon_detector.h"
@@ -51,6 +51,7 @@ typedef struct {
     const char *StateName;
     char depth;
     ES_Event Event;
+    uint32_t Time; // core timer count when the function was entered
 
 
 } TattleDataPoint;
@@ -75,7 +76,9 @@ static uint8_t tattleRecursiveCount = 0;
  * @Function ES_TattleTaleDump(void)
  * @param None.
  * @return None.
- * @brief Dumps all events caught by tattle and tail in one trace.
+ * @brief Dumps all events caught by tattle and tail in one trace, each with the
+ * microseconds since the start of the trace. The trace goes into the deferred
+ * log, so the dump no longer waits for the UART to empty after every point.
  * @note  PRIVATE FUNCTION: do not call this function
  * @author Max Dunne, 2013.09.26 */
 void ES_TattleTaleDump(void)
@@ -83,25 +86,27 @@ void ES_TattleTaleDump(void)
     uint8_t curDataPoint = 0;
     tattleDepth = 0;
     T1CONCLR = _T1CON_ON_MASK;
-    printf("\r\n");
+    ES_LOG0(LOG_TATTLE_START);
     for (curDataPoint = 0; curDataPoint < tattleCount; curDataPoint++) {
 #ifdef SUPPRESS_EXIT_ENTRY_IN_TATTLE
         if ((TattleData[curDataPoint].Event.EventType != ES_ENTRY) || (TattleData[curDataPoint].Event.EventType != ES_EXIT)) {
 #endif
-            printf("%s(%s[%s,%X])",
+            ES_LOG5((curDataPoint < (tattleCount - 1)) ? LOG_TATTLE_STEP : LOG_TATTLE_LAST,
                     TattleData[curDataPoint].FunctionName, TattleData[curDataPoint].StateName,          \
-                        EventNames[TattleData[curDataPoint].Event.EventType], TattleData[curDataPoint].Event.EventParam);
-            if (curDataPoint < (tattleCount - 1)) {
-                printf("->");
-            } else {
-                printf(";");
-            }
-            while (!IsTransmitEmpty());
+                        EventNames[TattleData[curDataPoint].Event.EventType], TattleData[curDataPoint].Event.EventParam,
+                    (TattleData[curDataPoint].Time - TattleData[0].Time) / ES_TIMESTAMP_TICKS_PER_US);
 #ifdef SUPPRESS_EXIT_ENTRY_IN_TATTLE
         }
 #endif
     }
-    printf("\n");
+#ifdef USE_EVENT_TIMESTAMPS
+    // how long the event that started the trace waited in the queues
+    if (tattleCount != 0) {
+        ES_LOG1(LOG_TATTLE_POSTED, (TattleData[0].Time - TattleData[0].Event.EventTime) /
+                ES_TIMESTAMP_TICKS_PER_US);
+    }
+#endif
+    ES_LOG0(LOG_TATTLE_END);
     tattleCount = 0;
     T1CONSET = _T1CON_ON_MASK;
 }
@@ -122,6 +127,7 @@ void ES_AddTattlePoint(const char * FunctionName, const char * StateName, ES_Eve
         TattleData[tattleCount].FunctionName = FunctionName;
         TattleData[tattleCount].StateName = StateName;
         TattleData[tattleCount].Event = ThisEvent;
+        TattleData[tattleCount].Time = _CP0_GET_COUNT();
         TattleData[tattleCount].depth = tattleDepth;
         tattleCount++;
     }
@@ -45,7 +45,6 @@
 #include "ES_Framework.h"
 #include "ES_ServiceHeaders.h"
 #include "ES_Events.h"
-#include "ES_PostList.h"
 #include "ES_LookupTables.h"
 #include "ES_Timers.h"
 /*--------------------------- External Variables --------------------------*/
@@ -56,23 +55,95 @@
 #define F_PB F_CPU/2
 #define TIMER_FREQUENCY 1000
 
-#define NUM_TIMERS 16
-#define TranslatePin(x) (1<<x)
+#define NUM_TIMERS 32
+#define TranslatePin(x) (1UL<<(x))
+#define NO_TIMER 0xFF // end of the active list
+#define CORE_TICKS_PER_MS (ES_TIMESTAMP_TICKS_PER_US * 1000)
+// longest the tickless mode goes without an interrupt, well inside the 107 s
+// it takes the core timer to wrap
+#define MAX_TICKLESS_MS 10000
+// with the idle wait the polled event checkers only run when an interrupt
+// wakes the core, and without the 1 ms tick that can be seconds apart
+#if defined(USE_TICKLESS_TIMERS) && defined(USE_IDLE_WAIT) && defined(EVENT_CHECK_SCHEDULE)
+#error USE_TICKLESS_TIMERS with USE_IDLE_WAIT needs the checkers moved to USE_PERIODIC_TASKS
+#endif
+// pooled timer handles, see ES_TimerHandle_t
+#define HANDLE_FLAG 0x8000
+#define HANDLE_NUM_BITS 5
+#define HANDLE_NUM_MASK ((1 << HANDLE_NUM_BITS) - 1)
+#define HANDLE_GEN_MASK (0x7FFF >> HANDLE_NUM_BITS)
+// timers that fit in the EventParam mask of an ES_TIMEOUT_BATCH
+#define BATCH_TIMERS 16
+#define IsNumberedTimer(Num) ((Num < NUM_TIMERS) && \
+    (Timer2PostFunc[Num] != TIMER_UNUSED) && (Timer2PostFunc[Num] != TIMER_POOL))
 /*------------------------------ Module Types -----------------------------*/
 
 
 
 /*---------------------------- Module Functions ---------------------------*/
-
+static void InsertTimer(uint8_t Num, uint32_t Ticks);
+static uint32_t RemoveTimer(uint8_t Num);
+static void AdvanceTimers(uint32_t Elapsed);
+static void TrackCoreWraps(void);
+static void ArmTimer(uint8_t Num, uint32_t NewTime, uint32_t Period);
+static void NotifyTimer(uint8_t Num, ES_EventTyp_t EventType);
+#ifdef USE_TICKLESS_TIMERS
+static void CatchUpTimers(void);
+static void ScheduleNextExpiry(void);
+#endif
+static uint32_t LockTimers(void);
+static void UnlockTimers(uint32_t SavedEnable);
+static uint8_t PostPooledTimer(ES_Event ThisEvent);
+static uint8_t HandleToTimer(ES_TimerHandle_t Handle);
+#ifdef BATCH_TIMEOUT_EVENTS
+static void PostBatchedTimeouts(uint32_t Expired);
+#endif
 
 /*---------------------------- Module Variables ---------------------------*/
+// the time a timer was set to, or the time it had left when it was stopped;
+// 0 once it has expired
 static unsigned int TMR_TimerArray[NUM_TIMERS];
 
+// the active timers form a list sorted by expiry time, starting at
+// ActiveHead. TimerDelta is how many ticks after the previous timer in the
+// list each one expires, so only the head is counted down by the ISR.
+static uint8_t ActiveHead = NO_TIMER;
+static uint8_t TimerNext[NUM_TIMERS];
+static uint8_t TimerPrev[NUM_TIMERS];
+static uint32_t TimerDelta[NUM_TIMERS];
+
+// the reload of each periodic timer, 0 for a one shot timer
+static uint32_t TimerPeriod[NUM_TIMERS];
+
+// for the TIMER_POOL timers: where the one that is in use posts (0 while it
+// is in the pool), what it passes back, and how often it has been given out
+static pPostFunc PooledPostFunc[NUM_TIMERS];
+static uint32_t PooledContext[NUM_TIMERS];
+static uint16_t PooledGeneration[NUM_TIMERS];
+
 // make this one const to get it put into flash, since it will never change
 
 
-static unsigned int TMR_ActiveFlags;
-static uint32_t FreeRunningTimer; /* this is used by the default RTI routine */
+static uint32_t TMR_ActiveFlags;
+static volatile uint32_t FreeRunningTimer; /* this is used by the default RTI routine */
+// how often the core timer has wrapped, shifted up one, with the top bit of
+// the count when it was last looked at in bit 0. One word, so that it is
+// always read and written whole; see TrackCoreWraps.
+static volatile uint32_t CoreEpoch;
+#ifdef USE_TICKLESS_TIMERS
+// core timer count at which FreeRunningTimer was last brought up to date,
+// always a whole number of milliseconds after the start
+static volatile uint32_t LastUpdateCount;
+#endif
+
+#ifdef USE_SERVICE_STATS
+static uint32_t ISRMaxTicks;
+static uint32_t ISRCount;
+static uint64_t ISRTotalTicks;
+// ES_TIMERACTIVE/ES_TIMERSTOPPED events that TIMER_NOTIFY_MASK kept out of
+// the queues
+static uint32_t NotifySkipped;
+#endif
 
 static pPostFunc const Timer2PostFunc[NUM_TIMERS] = {TIMER0_RESP_FUNC,
     TIMER1_RESP_FUNC,
@@ -89,7 +160,23 @@ static pPostFunc const Timer2PostFunc[NUM_TIMERS] = {TIMER0_RESP_FUNC,
     TIMER12_RESP_FUNC,
     TIMER13_RESP_FUNC,
     TIMER14_RESP_FUNC,
-    TIMER15_RESP_FUNC};
+    TIMER15_RESP_FUNC,
+    TIMER16_RESP_FUNC,
+    TIMER17_RESP_FUNC,
+    TIMER18_RESP_FUNC,
+    TIMER19_RESP_FUNC,
+    TIMER20_RESP_FUNC,
+    TIMER21_RESP_FUNC,
+    TIMER22_RESP_FUNC,
+    TIMER23_RESP_FUNC,
+    TIMER24_RESP_FUNC,
+    TIMER25_RESP_FUNC,
+    TIMER26_RESP_FUNC,
+    TIMER27_RESP_FUNC,
+    TIMER28_RESP_FUNC,
+    TIMER29_RESP_FUNC,
+    TIMER30_RESP_FUNC,
+    TIMER31_RESP_FUNC};
 
 
 
@@ -103,10 +190,21 @@ static pPostFunc const Timer2PostFunc[NUM_TIMERS] = {TIMER0_RESP_FUNC,
  * @brief  Initializes the timer module
  * @author Max Dunne, 2011.11.15 */
  void ES_Timer_Init(void) {
+#ifdef USE_TICKLESS_TIMERS
+    // the core timer compare interrupt replaces the Timer1 tick. It runs at
+    // the same priority so that it posts through the same ISR ring.
+    IEC0CLR = _IEC0_CTIE_MASK;
+    LastUpdateCount = _CP0_GET_COUNT();
+    IPC0CLR = _IPC0_CTIP_MASK | _IPC0_CTIS_MASK;
+    IPC0SET = (3 << _IPC0_CTIP_POSITION);
+    ScheduleNextExpiry();
+    IEC0SET = _IEC0_CTIE_MASK;
+#else
     OpenTimer1(T1_ON | T1_SOURCE_INT | T1_PS_1_1, F_PB / TIMER_FREQUENCY);
     ConfigIntTimer1(T1_INT_ON | T1_INT_PRIOR_3);
 
     mT1IntEnable(1);
+#endif
 }
 
 /**
@@ -117,12 +215,19 @@ static pPostFunc const Timer2PostFunc[NUM_TIMERS] = {TIMER0_RESP_FUNC,
  * @brief  sets the time for a timer, but does not make it active.
  * @author Max Dunne  2011.11.15 */
 ES_TimerReturn_t ES_Timer_SetTimer(uint8_t Num, uint32_t NewTime) {
-    static ES_Event NewEvent;
+    uint32_t SavedEnable;
     // tried to set a timer that doesn't exist
-    if ((Num >= NUM_TIMERS) || (Timer2PostFunc[Num] == TIMER_UNUSED) || (NewTime == 0)) {
+    if (!IsNumberedTimer(Num) || (NewTime == 0)) {
         return ES_Timer_ERR;
     }
+    SavedEnable = LockTimers();
     TMR_TimerArray[Num] = NewTime;
+    // a running timer carries on from the new time
+    if (TMR_ActiveFlags & TranslatePin(Num)) {
+        RemoveTimer(Num);
+        InsertTimer(Num, NewTime);
+    }
+    UnlockTimers(SavedEnable);
     return ES_Timer_OK;
 }
 
@@ -133,16 +238,18 @@ ES_TimerReturn_t ES_Timer_SetTimer(uint8_t Num, uint32_t NewTime) {
  * @brief  simply sets the active flag in TMR_ActiveFlags to resart a stopped timer.
  * @author Max Dunne, 2011.11.15 */
 ES_TimerReturn_t ES_Timer_StartTimer(uint8_t Num) {
-    static ES_Event NewEvent;
+    uint32_t SavedEnable;
     // tried to set a timer that doesn't exist
-    if ((Num >= NUM_TIMERS) || (TMR_TimerArray[Num] == 0)) {
+    if (!IsNumberedTimer(Num) || (TMR_TimerArray[Num] == 0)) {
         return ES_Timer_ERR;
     }
-    TMR_ActiveFlags |= TranslatePin(Num); /* set timer as active */
-    NewEvent.EventType = ES_TIMERACTIVE;
-    NewEvent.EventParam = Num;
-    // post the timeout event to the right Service
-    Timer2PostFunc[Num](NewEvent);
+    SavedEnable = LockTimers();
+    if (!(TMR_ActiveFlags & TranslatePin(Num))) {
+        InsertTimer(Num, TMR_TimerArray[Num]);
+        TMR_ActiveFlags |= TranslatePin(Num); /* set timer as active */
+    }
+    UnlockTimers(SavedEnable);
+    NotifyTimer(Num, ES_TIMERACTIVE);
     return ES_Timer_OK;
 }
 
@@ -154,15 +261,20 @@ ES_TimerReturn_t ES_Timer_StartTimer(uint8_t Num) {
  * will cause it to stop counting.
  * @author Max Dunne 2011.11.15 */
 ES_TimerReturn_t ES_Timer_StopTimer(unsigned char Num) {
-    static ES_Event NewEvent;
-    if ((Num >= NUM_TIMERS) || (Timer2PostFunc[Num] == TIMER_UNUSED) || !(TMR_ActiveFlags & TranslatePin(Num))) {
+    uint32_t SavedEnable;
+    if (!IsNumberedTimer(Num)) {
         return ES_Timer_ERR; // tried to set a timer that doesn't exist
     }
+    SavedEnable = LockTimers();
+    if (!(TMR_ActiveFlags & TranslatePin(Num))) {
+        UnlockTimers(SavedEnable);
+        return ES_Timer_ERR; // or one that isn't running
+    }
+    // keep the time left so that StartTimer carries on from there
+    TMR_TimerArray[Num] = RemoveTimer(Num);
     TMR_ActiveFlags &= ~(TranslatePin(Num)); // set timer as inactive
-    NewEvent.EventType = ES_TIMERSTOPPED;
-    NewEvent.EventParam = Num;
-    // post the timeout event to the right Service
-    Timer2PostFunc[Num](NewEvent);
+    UnlockTimers(SavedEnable);
+    NotifyTimer(Num, ES_TIMERSTOPPED);
     return ES_Timer_OK;
 }
 
@@ -172,33 +284,220 @@ ES_TimerReturn_t ES_Timer_StopTimer(unsigned char Num) {
  * @param NewTime - the number of tick to be counted
  * @return ERROR or SUCCESS
  * @brief  sets the NewTime into the chosen timer and clears any previous event flag 
- * and sets the timer actice to begin counting.
+ * and sets the timer actice to begin counting. A periodic timer becomes a one
+ * shot timer again.
  * @author Max Dunne 2011.11.15 */
 ES_TimerReturn_t ES_Timer_InitTimer(uint8_t Num, uint32_t NewTime) {
-    static ES_Event NewEvent;
-    if ((Num >= NUM_TIMERS) || (Timer2PostFunc[Num] == TIMER_UNUSED) || (NewTime == 0)) {
+    if (!IsNumberedTimer(Num) || (NewTime == 0)) {
         return ES_Timer_ERR;
     }
-    TMR_TimerArray[Num] = NewTime;
-    TMR_ActiveFlags |= TranslatePin(Num); /* set timer as active */
-    NewEvent.EventType = ES_TIMERACTIVE;
-    NewEvent.EventParam = Num;
-    // post the timeout event to the right Service
-    Timer2PostFunc[Num](NewEvent);
+    ArmTimer(Num, NewTime, 0);
     return ES_Timer_OK;
 }
 
+/**
+ * @Function ES_Timer_InitPeriodicTimer(uint8_t Num, uint32_t Period)
+ * @param Num -  the number of the timer to start
+ * @param Period - the number of ticks between timeouts
+ * @return ERROR or SUCCESS
+ * @brief  starts the timer like ES_Timer_InitTimer, but the ISR reloads it
+ * every time it expires, so it keeps posting ES_TIMEOUT every Period ticks
+ * until it is stopped or re-initialized as a one shot timer. Each period
+ * counts from when the last one was due, not from when the service got to
+ * it, so the timeouts don't drift. ES_Timer_StopTimer and
+ * ES_Timer_StartTimer pause and resume it, still periodic. */
+ES_TimerReturn_t ES_Timer_InitPeriodicTimer(uint8_t Num, uint32_t Period) {
+    if (!IsNumberedTimer(Num) || (Period == 0)) {
+        return ES_Timer_ERR;
+    }
+    ArmTimer(Num, Period, Period);
+    return ES_Timer_OK;
+}
+
+/**
+ * @Function ES_Timer_StartPooled(pPostFunc PostFunc, uint32_t Context,
+ *                                uint32_t NewTime, uint32_t Period)
+ * @param PostFunc - where the ES_TIMEOUT is posted
+ * @param Context - passed back in the EventPayload of the ES_TIMEOUT
+ * @param NewTime - the number of ticks to the first timeout
+ * @param Period - the number of ticks between later timeouts, 0 for one shot
+ * @return the handle of the timer, ES_TIMER_NO_HANDLE if no TIMER_POOL timer
+ * is free or PostFunc/NewTime is 0
+ * @brief  A state machine keeps the handle and checks it against the
+ * EventParam of its timeouts, so it only ever sees its own. A one shot timer
+ * goes back to the pool by itself when it expires, so the pool only has to
+ * be as big as the number of timers running at once. Context only reaches
+ * the service with USE_EVENT_PAYLOAD. */
+ES_TimerHandle_t ES_Timer_StartPooled(pPostFunc PostFunc, uint32_t Context,
+        uint32_t NewTime, uint32_t Period) {
+    ES_TimerHandle_t Handle = ES_TIMER_NO_HANDLE;
+    uint32_t SavedEnable;
+    uint8_t Num;
+
+    if ((PostFunc == TIMER_UNUSED) || (NewTime == 0)) {
+        return ES_TIMER_NO_HANDLE;
+    }
+    SavedEnable = LockTimers();
+    for (Num = 0; Num < NUM_TIMERS; Num++) {
+        if ((Timer2PostFunc[Num] == TIMER_POOL) && (PooledPostFunc[Num] == TIMER_UNUSED)) {
+            break;
+        }
+    }
+    if (Num < NUM_TIMERS) {
+        PooledPostFunc[Num] = PostFunc;
+        PooledContext[Num] = Context;
+        PooledGeneration[Num] = (PooledGeneration[Num] + 1) & HANDLE_GEN_MASK;
+        Handle = HANDLE_FLAG | (PooledGeneration[Num] << HANDLE_NUM_BITS) | Num;
+        TMR_TimerArray[Num] = NewTime;
+        TimerPeriod[Num] = Period;
+        InsertTimer(Num, NewTime);
+        TMR_ActiveFlags |= TranslatePin(Num);
+    }
+    UnlockTimers(SavedEnable);
+    return Handle;
+}
+
+/**
+ * @Function ES_Timer_CancelPooled(ES_TimerHandle_t Handle)
+ * @param Handle - from ES_Timer_StartPooled
+ * @return ES_Timer_OK, or ES_Timer_ERR if the handle is stale
+ * @brief  stops the timer and puts it back in the pool. Cancelling a handle
+ * whose one shot has already expired does nothing, so a state can always
+ * cancel its handle on exit. */
+ES_TimerReturn_t ES_Timer_CancelPooled(ES_TimerHandle_t Handle) {
+    uint32_t SavedEnable;
+    uint8_t Num;
+    ES_TimerReturn_t ReturnVal = ES_Timer_ERR;
+
+    SavedEnable = LockTimers();
+    Num = HandleToTimer(Handle);
+    if (Num != NO_TIMER) {
+        if (TMR_ActiveFlags & TranslatePin(Num)) {
+            RemoveTimer(Num);
+            TMR_ActiveFlags &= ~(TranslatePin(Num));
+        }
+        PooledPostFunc[Num] = TIMER_UNUSED;
+        ReturnVal = ES_Timer_OK;
+    }
+    UnlockTimers(SavedEnable);
+    return ReturnVal;
+}
+
+/**
+ * @Function ES_Timer_IsCurrentHandle(ES_TimerHandle_t Handle)
+ * @param Handle - usually the EventParam of an ES_TIMEOUT
+ * @return TRUE if Handle still names a pooled timer that is in use
+ * @brief  a one shot handle is no longer current once its timeout has been
+ * posted, compare the EventParam with the saved handle instead to match it */
+uint8_t ES_Timer_IsCurrentHandle(ES_TimerHandle_t Handle) {
+    return (HandleToTimer(Handle) != NO_TIMER);
+}
+
 /**
  * Function: ES_Timer_GetTime(void)
  * @param None
  * @return FreeRunningTimer - the current value of the module variable FreeRunningTimer
  * @remark Provides the ability to grab a snapshot time as an alternative to using
  * the library timers. Can be used to determine how long between 2 events.
+ * In tickless mode the milliseconds since the last timer interrupt are worked
+ * out from the core timer, so the time is just as exact without the tick.
  * @author Max Dunne, 2011.11.15  */
 uint32_t ES_Timer_GetTime(void) {
+#ifdef USE_TICKLESS_TIMERS
+    uint32_t Base;
+    uint32_t BaseCount;
+
+    // read the pair again if the timer interrupt updated it in between
+    do {
+        BaseCount = LastUpdateCount;
+        Base = FreeRunningTimer;
+    } while (BaseCount != LastUpdateCount);
+    return Base + (_CP0_GET_COUNT() - BaseCount) / CORE_TICKS_PER_MS;
+#else
     return (FreeRunningTimer);
+#endif
 }
 
+/**
+ * @Function ES_Timer_GetTimestamp(void)
+ * @param None
+ * @return core timer ticks since reset, 64 bits
+ * @brief  the core timer count, with the number of times it has wrapped (every
+ * 107 s) on top. The timer ISR keeps count of the wraps; if the count has
+ * wrapped again since the ISR last looked, the top bit it saw is set and the
+ * count's is clear, so that wrap is added here. The ISR must look at least
+ * every 53 s, which the tick (or the 10 s tickless limit) does. */
+uint64_t ES_Timer_GetTimestamp(void) {
+    uint32_t Epoch = CoreEpoch;
+    uint32_t Count = _CP0_GET_COUNT();
+    uint32_t Wraps = Epoch >> 1;
+
+    if ((Epoch & 1) && !(Count & 0x80000000)) {
+        Wraps++;
+    }
+    return ((uint64_t) Wraps << 32) | Count;
+}
+
+/**
+ * @Function ES_Timer_GetMicros(void)
+ * @param None
+ * @return microseconds since reset
+ * @brief  for printing, take the difference of two ES_Timer_GetTimestamp
+ * values and scale that where the time matters */
+uint64_t ES_Timer_GetMicros(void) {
+    return ES_Timer_GetTimestamp() / ES_TIMESTAMP_TICKS_PER_US;
+}
+
+#ifdef USE_SERVICE_STATS
+/**
+ * @Function ES_Timer_GetISRTime(uint32_t *pMeanUs, uint32_t *pMaxUs)
+ * @param pMeanUs - returns the average run time of the tick ISR, in microseconds
+ * @param pMaxUs - returns the longest run time of the tick ISR, in microseconds
+ * @return None.
+ * @brief  Timed with the core timer since ES_Timer_ClearISRTime. The times
+ *         do not include the interrupt entry and exit code. */
+void ES_Timer_GetISRTime(uint32_t *pMeanUs, uint32_t *pMaxUs) {
+    uint32_t SavedEnable = LockTimers();
+
+    *pMeanUs = ISRCount ? (uint32_t) ((ISRTotalTicks / ISRCount) / ES_TIMESTAMP_TICKS_PER_US) : 0;
+    *pMaxUs = ISRMaxTicks / ES_TIMESTAMP_TICKS_PER_US;
+    UnlockTimers(SavedEnable);
+}
+
+/**
+ * @Function ES_Timer_ClearISRTime(void)
+ * @param None.
+ * @return None.
+ * @brief  restarts the tick ISR timing */
+void ES_Timer_ClearISRTime(void) {
+    uint32_t SavedEnable = LockTimers();
+
+    ISRMaxTicks = 0;
+    ISRCount = 0;
+    ISRTotalTicks = 0;
+    UnlockTimers(SavedEnable);
+}
+
+/**
+ * @Function ES_Timer_GetSkippedNotifies(void)
+ * @param None.
+ * @return the number of ES_TIMERACTIVE/ES_TIMERSTOPPED events not posted
+ *         because of TIMER_NOTIFY_MASK since ES_Timer_ClearSkippedNotifies
+ * @brief  each of these would have been one more event to dispatch */
+uint32_t ES_Timer_GetSkippedNotifies(void) {
+    return NotifySkipped;
+}
+
+/**
+ * @Function ES_Timer_ClearSkippedNotifies(void)
+ * @param None.
+ * @return None.
+ * @brief  restarts the count of ES_Timer_GetSkippedNotifies */
+void ES_Timer_ClearSkippedNotifies(void) {
+    NotifySkipped = 0;
+}
+#endif
+
 /****************************************************************************
  Function
      ES_Timer_RTI_Resp
@@ -209,40 +508,500 @@ uint32_t ES_Timer_GetTime(void) {
  Description
      This is the new RTI response routine to support the timer module.
      It will increment time, to maintain the functionality of the
-     GetTime() timer and it will check through the active timers,
-     decrementing each active timers count, if the count goes to 0, it
-     will post an event to the corresponding SM and clear the active flag to
-     prevent further counting.
+     GetTime() timer and it will count down the first timer in the active
+     list, see AdvanceTimers.
  Notes
      None.
  Author
      J. Edward Carryer, 02/24/97 15:06
  ****************************************************************************/
+#ifndef USE_TICKLESS_TIMERS
 void __ISR(_TIMER_1_VECTOR, ipl3auto) Timer1IntHandler(void) {
-    static ES_Event NewEvent;
-    uint8_t CurTimer = 0;
+#ifdef USE_SERVICE_STATS
+    uint32_t StartTicks = _CP0_GET_COUNT();
+    uint32_t RunTicks;
+#endif
     mT1ClearIntFlag();
 #ifdef USE_KEYBOARD_INPUT
     return;
 #endif
     ++FreeRunningTimer; // keep the GetTime() timer running 
-    if (TMR_ActiveFlags != 0) {
-        for (CurTimer = 0; CurTimer < NUM_TIMERS; CurTimer++) {
-            if ((TMR_ActiveFlags & (TranslatePin(CurTimer))) != 0) {
-                if (--TMR_TimerArray[CurTimer] == 0) {
-                    NewEvent.EventType = ES_TIMEOUT;
-                    NewEvent.EventParam = CurTimer;
-                    // post the timeout event to the right Service
-                    Timer2PostFunc[CurTimer](NewEvent);
-                    // and stop counting
-                    TMR_ActiveFlags &= ~(TranslatePin(CurTimer));
-                }
+    TrackCoreWraps();
+    AdvanceTimers(1);
+#ifdef USE_SERVICE_STATS
+    RunTicks = _CP0_GET_COUNT() - StartTicks;
+    ISRCount++;
+    ISRTotalTicks += RunTicks;
+    if (RunTicks > ISRMaxTicks) {
+        ISRMaxTicks = RunTicks;
+    }
+#endif
+}
+#else
 
+/****************************************************************************
+ Function
+     CoreTimerIntHandler
+ Parameters
+     None.
+ Returns
+     None.
+ Description
+     tickless mode: runs when the nearest timer is due (or MAX_TICKLESS_MS
+     has gone by), brings the time and the active list up to date and
+     programs the compare for the next expiry
+ Notes
+     None.
+ ****************************************************************************/
+void __ISR(_CORE_TIMER_VECTOR, ipl3auto) CoreTimerIntHandler(void) {
+#ifdef USE_SERVICE_STATS
+    uint32_t StartTicks = _CP0_GET_COUNT();
+    uint32_t RunTicks;
+#endif
+    // the flag is cleared by ScheduleNextExpiry, it has to go after the
+    // compare register is written
+    TrackCoreWraps();
+    CatchUpTimers();
+    ScheduleNextExpiry();
+#ifdef USE_SERVICE_STATS
+    RunTicks = _CP0_GET_COUNT() - StartTicks;
+    ISRCount++;
+    ISRTotalTicks += RunTicks;
+    if (RunTicks > ISRMaxTicks) {
+        ISRMaxTicks = RunTicks;
+    }
+#endif
+}
+#endif
+
+/****************************************************************************
+ private functions
+ ****************************************************************************/
+
+/****************************************************************************
+ Function
+     AdvanceTimers
+ Parameters
+     uint32_t Elapsed : milliseconds that have gone by
+ Returns
+     None.
+ Description
+     takes Elapsed off the head of the active list. Every timer at the head
+     whose count has run out posts an ES_TIMEOUT to the corresponding SM and
+     is taken off the list, so this costs the same no matter how many timers
+     are running. A periodic timer goes straight back into the list one
+     period after the moment it was due. With BATCH_TIMEOUT_EVENTS the
+     timeouts of timers 0 to 15 are gathered and posted together at the end,
+     see PostBatchedTimeouts.
+ Notes
+     called from the timer interrupt, or with the timers locked
+ ****************************************************************************/
+static void AdvanceTimers(uint32_t Elapsed) {
+    ES_Event NewEvent;
+    uint8_t CurTimer;
+#ifdef BATCH_TIMEOUT_EVENTS
+    uint32_t Expired = 0;
+#endif
+
+    while ((ActiveHead != NO_TIMER) && (TimerDelta[ActiveHead] <= Elapsed)) {
+        CurTimer = ActiveHead;
+        Elapsed -= TimerDelta[CurTimer];
+        // and stop counting
+        ActiveHead = TimerNext[CurTimer];
+        if (ActiveHead != NO_TIMER) {
+            TimerPrev[ActiveHead] = NO_TIMER;
+        }
+        if (TimerPeriod[CurTimer] != 0) {
+            InsertTimer(CurTimer, TimerPeriod[CurTimer]);
+        } else {
+            TMR_ActiveFlags &= ~(TranslatePin(CurTimer));
+            TMR_TimerArray[CurTimer] = 0;
+        }
+#ifdef BATCH_TIMEOUT_EVENTS
+        if ((CurTimer < BATCH_TIMERS) && (Timer2PostFunc[CurTimer] != TIMER_POOL)) {
+            Expired |= TranslatePin(CurTimer); // posted below, with the rest
+            continue;
+        }
+#endif
+        NewEvent.EventType = ES_TIMEOUT;
+        NewEvent.EventParam = CurTimer;
+        // post the timeout event to the right Service
+        Timer2PostFunc[CurTimer](NewEvent);
+    }
+    if (ActiveHead != NO_TIMER) {
+        TimerDelta[ActiveHead] -= Elapsed;
+    }
+#ifdef BATCH_TIMEOUT_EVENTS
+    if (Expired != 0) {
+        PostBatchedTimeouts(Expired);
+    }
+#endif
+}
+
+#ifdef BATCH_TIMEOUT_EVENTS
+/****************************************************************************
+ Function
+     PostBatchedTimeouts
+ Parameters
+     uint32_t Expired : bit n set for each of timers 0 to 15 that expired
+ Returns
+     None.
+ Description
+     posts one event to each service that owns a timer in Expired: an
+     ES_TIMEOUT if only one of its timers is there, otherwise an
+     ES_TIMEOUT_BATCH with the mask of its timers in EventParam
+ Notes
+     a periodic timer that came round more than once while the tickless
+     mode was catching up is only posted once
+ ****************************************************************************/
+static void PostBatchedTimeouts(uint32_t Expired) {
+    ES_Event NewEvent;
+    pPostFunc PostFunc;
+    uint32_t Batch;
+    uint32_t Rest;
+    uint8_t Num;
+
+    while (Expired != 0) {
+        // gather the timers that post to the same place as the highest one
+        PostFunc = Timer2PostFunc[ES_GetMSBitNum(Expired)];
+        Batch = 0;
+        for (Rest = Expired; Rest != 0; Rest &= ~TranslatePin(Num)) {
+            Num = ES_GetMSBitNum(Rest);
+            if (Timer2PostFunc[Num] == PostFunc) {
+                Batch |= TranslatePin(Num);
             }
         }
+        Expired &= ~Batch;
+        if ((Batch & (Batch - 1)) == 0) {
+            NewEvent.EventType = ES_TIMEOUT;
+            NewEvent.EventParam = ES_GetMSBitNum(Batch);
+        } else {
+            NewEvent.EventType = ES_TIMEOUT_BATCH;
+            NewEvent.EventParam = Batch;
+        }
+        PostFunc(NewEvent);
+    }
+}
+#endif
+
+#ifdef USE_TICKLESS_TIMERS
+/****************************************************************************
+ Function
+     CatchUpTimers
+ Parameters
+     None.
+ Returns
+     None.
+ Description
+     adds the whole milliseconds counted by the core timer since the last
+     update to FreeRunningTimer and takes them off the active list
+ Notes
+     LastUpdateCount only moves in whole milliseconds, so no time is lost
+     to rounding
+ ****************************************************************************/
+static void CatchUpTimers(void) {
+    uint32_t Elapsed = (_CP0_GET_COUNT() - LastUpdateCount) / CORE_TICKS_PER_MS;
+
+    if (Elapsed != 0) {
+        LastUpdateCount += Elapsed * CORE_TICKS_PER_MS;
+        FreeRunningTimer += Elapsed;
+        AdvanceTimers(Elapsed);
+    }
+}
+
+/****************************************************************************
+ Function
+     ScheduleNextExpiry
+ Parameters
+     None.
+ Returns
+     None.
+ Description
+     sets the core timer compare to the expiry of the first active timer,
+     or MAX_TICKLESS_MS away if that is sooner or nothing is running
+ Notes
+     if the count is already past the new compare value (the list was just
+     caught up near the end of a millisecond), the interrupt is forced so
+     the expiry is not missed until the core timer wraps
+ ****************************************************************************/
+static void ScheduleNextExpiry(void) {
+    uint32_t Delay = MAX_TICKLESS_MS;
+    uint32_t Target;
+
+    if ((ActiveHead != NO_TIMER) && (TimerDelta[ActiveHead] < Delay)) {
+        Delay = TimerDelta[ActiveHead];
+    }
+    Target = LastUpdateCount + Delay * CORE_TICKS_PER_MS;
+    _CP0_SET_COMPARE(Target);
+    IFS0CLR = _IFS0_CTIF_MASK;
+    if ((int32_t) (_CP0_GET_COUNT() - Target) >= 0) {
+        IFS0SET = _IFS0_CTIF_MASK;
+    }
+}
+#endif
+
+/****************************************************************************
+ Function
+     TrackCoreWraps
+ Parameters
+     None.
+ Returns
+     None.
+ Description
+     counts a wrap of the core timer when its top bit has gone from 1 to 0
+     since the last call, for ES_Timer_GetTimestamp
+ Notes
+     called from the timer ISR only, so there is one writer. CoreEpoch is
+     written in one store, so a reader at any level sees either the old or
+     the new value, and both give the right timestamp.
+ ****************************************************************************/
+static void TrackCoreWraps(void) {
+    uint32_t Epoch = CoreEpoch;
+    uint32_t TopBit = _CP0_GET_COUNT() >> 31;
+    uint32_t Wraps = Epoch >> 1;
+
+    if ((Epoch & 1) && !TopBit) {
+        Wraps++;
+    }
+    CoreEpoch = (Wraps << 1) | TopBit;
+}
 
+/****************************************************************************
+ Function
+     ArmTimer
+ Parameters
+     uint8_t Num : the timer to (re)start
+     uint32_t NewTime : ticks until it first expires
+     uint32_t Period : ticks between later expiries, 0 for a one shot timer
+ Returns
+     None.
+ Description
+     the common part of ES_Timer_InitTimer and ES_Timer_InitPeriodicTimer,
+     which have already checked Num and NewTime
+ Notes
+
+ ****************************************************************************/
+static void ArmTimer(uint8_t Num, uint32_t NewTime, uint32_t Period) {
+    uint32_t SavedEnable;
+
+    SavedEnable = LockTimers();
+    if (TMR_ActiveFlags & TranslatePin(Num)) {
+        RemoveTimer(Num); // restarting a running timer
     }
+    TMR_TimerArray[Num] = NewTime;
+    TimerPeriod[Num] = Period;
+    InsertTimer(Num, NewTime);
+    TMR_ActiveFlags |= TranslatePin(Num); /* set timer as active */
+    UnlockTimers(SavedEnable);
+    NotifyTimer(Num, ES_TIMERACTIVE);
 }
+
+/****************************************************************************
+ Function
+     NotifyTimer
+ Parameters
+     uint8_t Num : the timer that was started or stopped
+     ES_EventTyp_t EventType : ES_TIMERACTIVE or ES_TIMERSTOPPED
+ Returns
+     None.
+ Description
+     posts EventType to the timer's service if the timer is in
+     TIMER_NOTIFY_MASK
+ Notes
+     with USE_SERVICE_STATS the events left out are counted, so one run
+     shows the dispatch rate both with and without them, see
+     ES_Timer_GetSkippedNotifies
+ ****************************************************************************/
+static void NotifyTimer(uint8_t Num, ES_EventTyp_t EventType) {
+    static ES_Event NewEvent;
+
+    if (TIMER_NOTIFY_MASK & TranslatePin(Num)) {
+        NewEvent.EventType = EventType;
+        NewEvent.EventParam = Num;
+        // post the event to the right Service
+        Timer2PostFunc[Num](NewEvent);
+    }
+#ifdef USE_SERVICE_STATS
+    else {
+        NotifySkipped++;
+    }
+#endif
+}
+
+/****************************************************************************
+ Function
+     PostPooledTimer
+ Parameters
+     ES_Event ThisEvent : the ES_TIMEOUT of a TIMER_POOL timer, EventParam
+     holding its number
+ Returns
+     uint8_t : what the post function returned, FALSE if nothing is posted
+ Description
+     the post function of every TIMER_POOL timer. Swaps the number for the
+     handle, adds the context and posts to the function the timer was
+     given out to. A one shot timer goes back to the pool here.
+ Notes
+     called from the timer interrupt, or with the timers locked
+ ****************************************************************************/
+static uint8_t PostPooledTimer(ES_Event ThisEvent) {
+    uint8_t Num = ThisEvent.EventParam;
+    pPostFunc PostFunc = PooledPostFunc[Num];
+
+    if (PostFunc == TIMER_UNUSED) {
+        return FALSE;
+    }
+    ThisEvent.EventParam = HANDLE_FLAG | (PooledGeneration[Num] << HANDLE_NUM_BITS) | Num;
+#ifdef USE_EVENT_PAYLOAD
+    ThisEvent.EventPayload = PooledContext[Num];
+#endif
+    if (TimerPeriod[Num] == 0) {
+        PooledPostFunc[Num] = TIMER_UNUSED;
+    }
+    return PostFunc(ThisEvent);
+}
+
+/****************************************************************************
+ Function
+     HandleToTimer
+ Parameters
+     ES_TimerHandle_t Handle : a handle from ES_Timer_StartPooled
+ Returns
+     uint8_t : the number of the timer, NO_TIMER if the handle is stale
+ Description
+     checks the handle against the timer's generation and that it is still
+     given out
+ Notes
+
+ ****************************************************************************/
+static uint8_t HandleToTimer(ES_TimerHandle_t Handle) {
+    uint8_t Num = Handle & HANDLE_NUM_MASK;
+
+    if (((Handle & HANDLE_FLAG) == 0) || (Timer2PostFunc[Num] != TIMER_POOL) ||
+            (PooledPostFunc[Num] == TIMER_UNUSED) ||
+            (((Handle & ~HANDLE_FLAG) >> HANDLE_NUM_BITS) != PooledGeneration[Num])) {
+        return NO_TIMER;
+    }
+    return Num;
+}
+
+/****************************************************************************
+ Function
+     InsertTimer
+ Parameters
+     uint8_t Num : the timer to add to the active list
+     uint32_t Ticks : ticks until it expires, at least 1
+ Returns
+     None.
+ Description
+     walks the active list to the first timer that expires later, inserts Num
+     in front of it and takes Num's share off that timer's delta
+ Notes
+     call with the timers locked and Num not already in the list
+ ****************************************************************************/
+static void InsertTimer(uint8_t Num, uint32_t Ticks) {
+    uint8_t Prev = NO_TIMER;
+    uint8_t Cur = ActiveHead;
+
+    while ((Cur != NO_TIMER) && (TimerDelta[Cur] <= Ticks)) {
+        Ticks -= TimerDelta[Cur];
+        Prev = Cur;
+        Cur = TimerNext[Cur];
+    }
+    TimerDelta[Num] = Ticks;
+    TimerNext[Num] = Cur;
+    TimerPrev[Num] = Prev;
+    if (Cur != NO_TIMER) {
+        TimerDelta[Cur] -= Ticks;
+        TimerPrev[Cur] = Num;
+    }
+    if (Prev != NO_TIMER) {
+        TimerNext[Prev] = Num;
+    } else {
+        ActiveHead = Num;
+    }
+}
+
+/****************************************************************************
+ Function
+     RemoveTimer
+ Parameters
+     uint8_t Num : the timer to take off the active list
+ Returns
+     uint32_t : the ticks Num had left
+ Description
+     unlinks Num and hands its delta on to the timer after it
+ Notes
+     call with the timers locked and Num in the list. Finding the time left
+     walks the list up to Num.
+ ****************************************************************************/
+static uint32_t RemoveTimer(uint8_t Num) {
+    uint32_t Remaining = 0;
+    uint8_t Cur;
+
+    for (Cur = ActiveHead; Cur != Num; Cur = TimerNext[Cur]) {
+        Remaining += TimerDelta[Cur];
+    }
+    Remaining += TimerDelta[Num];
+    if (TimerNext[Num] != NO_TIMER) {
+        TimerDelta[TimerNext[Num]] += TimerDelta[Num];
+        TimerPrev[TimerNext[Num]] = TimerPrev[Num];
+    }
+    if (TimerPrev[Num] != NO_TIMER) {
+        TimerNext[TimerPrev[Num]] = TimerNext[Num];
+    } else {
+        ActiveHead = TimerNext[Num];
+    }
+    return Remaining;
+}
+
+/****************************************************************************
+ Function
+     LockTimers
+ Parameters
+     None.
+ Returns
+     uint32_t : the Timer1 interrupt enable bit as it was
+ Description
+     keeps the tick ISR out while the active list is being changed
+ Notes
+     only the timer interrupt is masked, everything else keeps running.
+     In tickless mode the list is brought up to date first, so times added
+     to it count from now.
+ ****************************************************************************/
+static uint32_t LockTimers(void) {
+#ifdef USE_TICKLESS_TIMERS
+    uint32_t SavedEnable = IEC0 & _IEC0_CTIE_MASK;
+
+    IEC0CLR = _IEC0_CTIE_MASK;
+    CatchUpTimers();
+#else
+    uint32_t SavedEnable = IEC0 & _IEC0_T1IE_MASK;
+
+    IEC0CLR = _IEC0_T1IE_MASK;
+#endif
+    return SavedEnable;
+}
+
+/****************************************************************************
+ Function
+     UnlockTimers
+ Parameters
+     uint32_t SavedEnable : the value returned by LockTimers
+ Returns
+     None.
+ Description
+     puts the timer interrupt enable back the way LockTimers found it
+ Notes
+     in tickless mode the compare is moved to whatever is now first in the
+     active list
+ ****************************************************************************/
+static void UnlockTimers(uint32_t SavedEnable) {
+#ifdef USE_TICKLESS_TIMERS
+    ScheduleNextExpiry();
+#endif
+    IEC0SET = SavedEnable;
+}
+
 /*------------------------------- Footnotes -------------------------------*/
 #ifdef TEST
 
@@ -27,6 +27,7 @@
 #ifndef ES_Timers_H
 #define ES_Timers_H
 
+#include "ES_Events.h"
 
 
 typedef enum { ES_Timer_ERR           = -1,
@@ -35,6 +36,16 @@ typedef enum { ES_Timer_ERR           = -1,
                ES_Timer_NOT_ACTIVE    =  0
 } ES_TimerReturn_t;
 
+// names a timer given out by ES_Timer_StartPooled. Its timeouts carry the
+// handle in EventParam; bit 15 is always set so it can't be mistaken for a
+// numbered timer, and the rest holds the timer and how often it has been
+// given out, so a handle goes stale once its timer is back in the pool.
+typedef uint16_t ES_TimerHandle_t;
+#define ES_TIMER_NO_HANDLE 0
+
+// the core timer runs at half the 80 MHz system clock
+#define ES_TIMESTAMP_TICKS_PER_US 40
+
 
 /**
  * @Function ES_Timer_Init(void)
@@ -54,6 +65,16 @@ void             ES_Timer_Init(void);
  * @author Max Dunne 2011.11.15 */
 ES_TimerReturn_t ES_Timer_InitTimer(uint8_t Num, uint32_t NewTime);
 
+/**
+ * @Function ES_Timer_InitPeriodicTimer(uint8_t Num, uint32_t Period)
+ * @param Num -  the number of the timer to start
+ * @param Period - the number of ticks between timeouts
+ * @return ERROR or SUCCESS
+ * @brief  starts a timer that posts ES_TIMEOUT every Period ticks, reloaded
+ * by the ISR so the timeouts don't drift, until it is stopped or started
+ * again with ES_Timer_InitTimer */
+ES_TimerReturn_t ES_Timer_InitPeriodicTimer(uint8_t Num, uint32_t Period);
+
 /**
  * @Function ES_Timer_SetTimer(uint8_t Num, uint32_t NewTime)
  * @param Num - the number of the timer to set.
@@ -80,6 +101,49 @@ ES_TimerReturn_t ES_Timer_StartTimer(uint8_t Num);
  * @author Max Dunne 2011.11.15 */
 ES_TimerReturn_t ES_Timer_StopTimer(uint8_t Num);
 
+/**
+ * @Function ES_Timer_StartPooled(pPostFunc PostFunc, uint32_t Context,
+ *                                uint32_t NewTime, uint32_t Period)
+ * @param PostFunc - where the ES_TIMEOUT is posted
+ * @param Context - passed back in the EventPayload of the ES_TIMEOUT
+ * @param NewTime - the number of ticks to the first timeout
+ * @param Period - the number of ticks between later timeouts, 0 for one shot
+ * @return the handle of the timer, ES_TIMER_NO_HANDLE if the pool is empty
+ * @brief  takes a free TIMER_POOL timer and starts it. A one shot timer goes
+ * back to the pool when it expires, a periodic one when it is cancelled. */
+ES_TimerHandle_t ES_Timer_StartPooled(pPostFunc PostFunc, uint32_t Context,
+                                      uint32_t NewTime, uint32_t Period);
+
+/**
+ * @Function ES_Timer_CancelPooled(ES_TimerHandle_t Handle)
+ * @param Handle - from ES_Timer_StartPooled
+ * @return ES_Timer_OK, or ES_Timer_ERR if the handle is stale
+ * @brief  stops the timer and puts it back in the pool. A timeout that is
+ * already queued still carries the old, now stale, handle. */
+ES_TimerReturn_t ES_Timer_CancelPooled(ES_TimerHandle_t Handle);
+
+/**
+ * @Function ES_Timer_IsCurrentHandle(ES_TimerHandle_t Handle)
+ * @param Handle - usually the EventParam of an ES_TIMEOUT
+ * @return TRUE if Handle still names a pooled timer that is in use */
+uint8_t          ES_Timer_IsCurrentHandle(ES_TimerHandle_t Handle);
+
+/**
+ * @Function ES_Timer_GetTimestamp(void)
+ * @param None
+ * @return core timer ticks (ES_TIMESTAMP_TICKS_PER_US to the microsecond)
+ *         since reset, in 64 bits so it never wraps
+ * @brief  lock free and safe from any interrupt level. The low 32 bits are
+ *         the core timer count itself, the same clock as EventTime. */
+uint64_t         ES_Timer_GetTimestamp(void);
+
+/**
+ * @Function ES_Timer_GetMicros(void)
+ * @param None
+ * @return microseconds since reset
+ * @brief  ES_Timer_GetTimestamp scaled, this costs a 64 bit divide */
+uint64_t         ES_Timer_GetMicros(void);
+
 /**
  * Function: ES_Timer_GetTime(void)
  * @param None
@@ -89,6 +153,37 @@ ES_TimerReturn_t ES_Timer_StopTimer(uint8_t Num);
  * @author Max Dunne, 2011.11.15  */
 uint32_t         ES_Timer_GetTime(void);
 
+#ifdef USE_SERVICE_STATS
+/**
+ * @Function ES_Timer_GetISRTime(uint32_t *pMeanUs, uint32_t *pMaxUs)
+ * @param pMeanUs - returns the average run time of the tick ISR, in microseconds
+ * @param pMaxUs - returns the longest run time of the tick ISR, in microseconds
+ * @return None.
+ * @brief  Timed with the core timer since ES_Timer_ClearISRTime. */
+void             ES_Timer_GetISRTime(uint32_t *pMeanUs, uint32_t *pMaxUs);
+
+/**
+ * @Function ES_Timer_ClearISRTime(void)
+ * @param None.
+ * @return None.
+ * @brief  restarts the tick ISR timing */
+void             ES_Timer_ClearISRTime(void);
+
+/**
+ * @Function ES_Timer_GetSkippedNotifies(void)
+ * @param None.
+ * @return the number of ES_TIMERACTIVE/ES_TIMERSTOPPED events not posted
+ *         because of TIMER_NOTIFY_MASK since ES_Timer_ClearSkippedNotifies */
+uint32_t         ES_Timer_GetSkippedNotifies(void);
+
+/**
+ * @Function ES_Timer_ClearSkippedNotifies(void)
+ * @param None.
+ * @return None.
+ * @brief  restarts the count of ES_Timer_GetSkippedNotifies */
+void             ES_Timer_ClearSkippedNotifies(void);
+#endif
+
 #endif   /* ES_Timers_H */
 /*------------------------------ End of file ------------------------------*/
 
@@ -35,13 +35,14 @@
 #include "motors.h"
 #include "stdio.h"
 #include "event_checker.h"
+#include "trackwire.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
 typedef enum {
     InitPState,
-    ForwardsState,
+    SeekPeakState,
     Stop1State,
     Stop2State,
     Turn90State,
@@ -50,14 +51,22 @@ typedef enum {
 
 static const char *StateNames[] = {
 	"InitPState",
-	"ForwardsState",
+	"SeekPeakState",
 	"Stop1State",
 	"Stop2State",
 	"Turn90State",
 };
 
 
-#define FORWARD_TIME 75
+// drive towards the trackwire peak, looking at the error this often, and go
+// on with the best we have if it is not reached in ALIGN_MAX_TIME
+#define ALIGN_TICK_TIME 20
+#define ALIGN_MAX_TIME 1500
+#define ALIGN_MAX_TICKS (ALIGN_MAX_TIME / ALIGN_TICK_TIME)
+// stop the motors while the error is inside this band, well within the
+// aligned error so the robot does not coast out of it. Standing still lets
+// the trackwire peak settle, which trackwire_is_aligned waits for.
+#define ALIGN_DEADBAND (TRACKWIRE_ALIGNED_ERROR / 2)
 #define STOP_MOTOR_TIME 200
 #define TANK_TURN_TIME 675
 
@@ -66,6 +75,7 @@ static const char *StateNames[] = {
  ******************************************************************************/
 /* Prototypes for private functions for this machine. They should be functions
    relevant to the behavior of this state machine */
+static void drive_towards_peak(void);
 
 /*******************************************************************************
  * PRIVATE MODULE VARIABLES                                                            *
@@ -75,6 +85,7 @@ static const char *StateNames[] = {
 
 static TemplateSubHSMState_t CurrentState = InitPState; // <- change name to match ENUM
 static uint8_t MyPriority;
+static uint8_t AlignTicks;
 
 
 /*******************************************************************************
@@ -136,7 +147,7 @@ ES_Event RunFSMAlignAtm6(ES_Event ThisEvent) {
                 makeTransition = TRUE;
                 ThisEvent.EventType = ES_NO_EVENT;
 
-                printf("****************************** FSMAlignATM6\r\n");
+                ES_LOG0(LOG_ALIGN_ATM6);
             }
             break;
         case Stop1State:
@@ -149,7 +160,7 @@ ES_Event RunFSMAlignAtm6(ES_Event ThisEvent) {
 
                 case ES_TIMEOUT:
                     if (ThisEvent.EventParam == ALIGN_ATM6_TIMER) {
-                        nextState = ForwardsState;
+                        nextState = SeekPeakState;
                         makeTransition = TRUE;
                         ThisEvent.EventType = ES_NO_EVENT;
                     }
@@ -172,12 +183,12 @@ ES_Event RunFSMAlignAtm6(ES_Event ThisEvent) {
             }
 
             break;
-        case ForwardsState: // in the first state, replace this with correct names
+        case SeekPeakState: // closed loop on the trackwire error until aligned
             switch (ThisEvent.EventType) {
                 case ES_ENTRY:
-
-                    ES_Timer_InitTimer(ALIGN_ATM6_TIMER, FORWARD_TIME);
-                    forwards();
+                    AlignTicks = 0;
+                    ES_Timer_InitTimer(ALIGN_ATM6_TIMER, ALIGN_TICK_TIME);
+                    drive_towards_peak();
                     break;
 
 
@@ -189,9 +200,13 @@ ES_Event RunFSMAlignAtm6(ES_Event ThisEvent) {
                     break;
                 case ES_TIMEOUT:
                     if (ThisEvent.EventParam == ALIGN_ATM6_TIMER) {
-                        // printf("--------------------FSMAlignATM6, ForwardsState\r\n");
-                        nextState = Stop2State;
-                        makeTransition = TRUE;
+                        if (trackwire_is_aligned() || (++AlignTicks >= ALIGN_MAX_TICKS)) {
+                            nextState = Stop2State;
+                            makeTransition = TRUE;
+                        } else {
+                            ES_Timer_InitTimer(ALIGN_ATM6_TIMER, ALIGN_TICK_TIME);
+                            drive_towards_peak();
+                        }
                         ThisEvent.EventType = ES_NO_EVENT;
                     }
                     break;
@@ -295,3 +310,21 @@ ES_Event RunFSMAlignAtm6(ES_Event ThisEvent) {
  * PRIVATE FUNCTIONS                                                           *
  ******************************************************************************/
 
+/**
+ * @Function drive_towards_peak(void)
+ * @param None.
+ * @return None.
+ * @brief  slowly forwards while the front coil is nearer the wire, slowly back
+ *         once the back one is, so an overshoot is driven back out. Stops
+ *         inside ALIGN_DEADBAND instead of hunting back and forth over 0. */
+static void drive_towards_peak(void) {
+    int16_t error = trackwire_get_error();
+
+    if (error >= ALIGN_DEADBAND) {
+        slow_forwards();
+    } else if (error <= -ALIGN_DEADBAND) {
+        slow_reverse();
+    } else {
+        stop();
+    }
+}
@@ -359,13 +359,8 @@ ES_Event RunFSMAttackRen(ES_Event ThisEvent) {
 
 
                 case TAPE_DETECTED:
-                    printf("REACHED TAPE DETECTED ------------------------------ \r\n");
-                    printf("Front = %d\r\n", get_front_tape_status());
-                    printf("LEft = %d\r\n", get_left_tape_status());
-                    printf("Right = %d\r\n", get_right_tape_status());
-                    printf("Center = %d\r\n", get_center_tape_status());
-                    printf("Back = %d\r\n", get_back_tape_status());
-                    printf("REACHED TAPE DETECTED ------------------------------ \r\n");
+                    ES_LOG5(LOG_REN_TAPE, get_front_tape_status(), get_left_tape_status(),
+                            get_right_tape_status(), get_center_tape_status(), get_back_tape_status());
                     
                     if (is_on_T() == TRUE) {
                         //                        nextState = StopState_5;
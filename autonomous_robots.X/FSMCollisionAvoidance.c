@@ -800,21 +800,21 @@ ES_Event RunFSMCollisionAvoidance(ES_Event ThisEvent) {
                 case ES_ENTRY:
 
                     stop();
-                    printf("is_on_T: %d, get_atm6_counter: %d\r\n", is_on_T(), get_ATM6_Counter());
+                    ES_LOG2(LOG_ON_T_COUNTER, is_on_T(), get_ATM6_Counter());
                     if ((is_on_T() == TRUE) && (get_ATM6_Counter() == 3)) {
                         ThisEvent.EventType = T_FOUND;
 
                     } else if ((is_on_T() == TRUE) && (get_ATM6_Counter() != 3)) {
                         ES_Timer_InitTimer(COLLISION_AVOIDANCE_TIMER, STOP_9_TIME);
-                        printf("TIMER_STARTED on Stop 9\r\n");
+                        ES_LOG0(LOG_STOP9_TIMER);
                     } else if (is_on_T() == FALSE) {
                         nextState = Forwards4State;
                         makeTransition = TRUE;
                         // PostTopHSM(ThisEvent);
                         ThisEvent.EventType = ES_NO_EVENT;
-                        printf("reach else if is_on_T() == FALSE\r\n");
+                        ES_LOG0(LOG_NOT_ON_T);
                     } else {
-                        printf("WTF!!!!!!!!!!\r\n");
+                        ES_LOG0(LOG_ON_T_ELSE);
                     }
                     break;
                 case ES_TIMEOUT:
@@ -282,12 +282,12 @@ ES_Event RunFSMExitShooter(ES_Event ThisEvent) {
                             PostTopHSM(ThisEvent);
                             ThisEvent.EventType = ES_NO_EVENT;
                             ATM6_Counter++;
-                            printf("\r\nATM6 DOWN2!!!!!!!,--------------------> counter= %d\r\n", ATM6_Counter);
+                            ES_LOG1(LOG_ATM6_DOWN, ATM6_Counter);
                         } else {
                             nextState = Reverse;
                             makeTransition = TRUE;
                             ThisEvent.EventType = ES_NO_EVENT;
-                            printf("\r\nATM6 Still UP!!!!!!!, ------------------> counter= %d\r\n", ATM6_Counter);
+                            ES_LOG1(LOG_ATM6_UP, ATM6_Counter);
                         }
                     }
                     break;
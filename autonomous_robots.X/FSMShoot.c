@@ -250,7 +250,7 @@ ES_Event RunFSMShoot(ES_Event ThisEvent) {
                 case ES_ENTRY:
 
                     ES_Timer_InitTimer(SHOOT_FSM_TIMER, START_MOTOR_HIGH_TIME);
-                    printf("startMotorFast, first_time --------> %d\r\n", first_time);
+                    ES_LOG1(LOG_SHOOTER_FAST, first_time);
                     if (first_time == TRUE) {
                         if (mode == REN) {
                             start_raise_extension();
@@ -33,6 +33,8 @@
 #include "TopHSM.h"
 #include "FSMStartWar.h"
 #include "motors.h"
+#include "beacon_detector.h"
+#include "beacon_bearing.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
@@ -40,17 +42,22 @@
 typedef enum {
     InitPSubState,
     FindBeacon,
+    CentreOnBeacon,
     TurnAway,
 } TemplateSubHSMState_t;
 
 static const char *StateNames[] = {
 	"InitPSubState",
 	"FindBeacon",
+	"CentreOnBeacon",
 	"TurnAway",
 };
 
 #define TANK_TURN_TIME 3000
+// give up on finding a whole beacon window after this long
 #define FIND_BEACON_TIME 10000
+// print the beacon detection latency seen while sweeping for it
+//#define PRINT_BEACON_LATENCY
 
 /*******************************************************************************
  * PRIVATE FUNCTION PROTOTYPES                                                 *
@@ -66,6 +73,8 @@ static const char *StateNames[] = {
 
 static TemplateSubHSMState_t CurrentState = InitPSubState; // <- change name to match ENUM
 static uint8_t MyPriority;
+// pooled timer for the state we are in, only held while this FSM is active
+static ES_TimerHandle_t StateTimer = ES_TIMER_NO_HANDLE;
 
 
 /*******************************************************************************
@@ -134,14 +143,35 @@ ES_Event RunFSMStartWar(ES_Event ThisEvent) {
                 case ES_ENTRY:
 
                     //  LED_SetBank(LED_BANK1, 0xf);
-                    ES_Timer_InitTimer(START_WAR_TIMER, FIND_BEACON_TIME);
+                    ES_Timer_CancelPooled(StateTimer);
+                    StateTimer = ES_Timer_StartPooled(PostTopHSM, 0, FIND_BEACON_TIME, 0);
+                    beacon_bearing_start();
                     tank_turn_right();
                     break;
+                case ES_EXIT:
+                    ES_Timer_CancelPooled(StateTimer);
+#ifdef PRINT_BEACON_LATENCY
+                    beacon_print_latency();
+#endif
+                    break;
                 case BEACON_FOUND:
+                    beacon_note_handled(ThisEvent); // edge to here, mid sweep
+                    beacon_bearing_edge(ThisEvent);
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+                case BEACON_LOST:
+                    // keep turning through the window, then come back to its centre
+                    if (beacon_bearing_edge(ThisEvent)) {
+                        nextState = CentreOnBeacon;
+                        makeTransition = TRUE;
+                    }
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
                 case ES_TIMEOUT:
-                    //                    nextState = TurnAway;
-                    //                    makeTransition = TRUE;
-                    //                    ThisEvent.EventType = ES_NO_EVENT;
+                    if (ThisEvent.EventParam != StateTimer) {
+                        break; // not ours, leave it for TopHSM
+                    }
+                    // no whole window, go on from wherever we are pointing
                     ThisEvent.EventType = GO_TO_FIND_LINE;
                     ThisEvent.EventParam = 0;
                     PostTopHSM(ThisEvent);
@@ -158,16 +188,63 @@ ES_Event RunFSMStartWar(ES_Event ThisEvent) {
 
             break;
 
+        case CentreOnBeacon: // turn back by as long as we have gone past the centre
+            // this assumes tank_turn_left() turns at the same rate as the
+            // tank_turn_right() of the sweep. They set the same duty cycles,
+            // but if the motors are not matched in reverse the robot stops
+            // short of the beacon or past it
+            switch (ThisEvent.EventType) {
+                case ES_ENTRY:
+                    ES_Timer_CancelPooled(StateTimer);
+                    // at least a tick, a timer can't be started for 0
+                    StateTimer = ES_Timer_StartPooled(PostTopHSM, 0, beacon_bearing_offset_ms() + 1, 0);
+                    tank_turn_left();
+                    break;
+                case ES_EXIT:
+                    ES_Timer_CancelPooled(StateTimer);
+                    break;
+
+                case ES_TIMEOUT:
+                    if (ThisEvent.EventParam != StateTimer) {
+                        break; // not ours, leave it for TopHSM
+                    }
+                    stop();
+                    ThisEvent.EventType = GO_TO_FIND_LINE;
+                    ThisEvent.EventParam = 0;
+                    PostTopHSM(ThisEvent);
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+
+                case BEACON_FOUND:
+                case BEACON_LOST:
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+
+                case ES_TIMERACTIVE:
+                case ES_TIMERSTOPPED:
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+            }
+
+            break;
+
         case TurnAway: // in the first state, replace this with correct names
             switch (ThisEvent.EventType) {
                 case ES_ENTRY:
 
                     //  LED_SetBank(LED_BANK1, 0xf);
-                    ES_Timer_InitTimer(START_WAR_TIMER, TANK_TURN_TIME);
+                    ES_Timer_CancelPooled(StateTimer);
+                    StateTimer = ES_Timer_StartPooled(PostTopHSM, 0, TANK_TURN_TIME, 0);
                     tank_turn_right();
                     break;
+                case ES_EXIT:
+                    ES_Timer_CancelPooled(StateTimer);
+                    break;
 
                 case ES_TIMEOUT:
+                    if (ThisEvent.EventParam != StateTimer) {
+                        break; // not ours, leave it for TopHSM
+                    }
                     stop();
                     ThisEvent.EventType = GO_TO_FIND_LINE;
                     break;
@@ -216,7 +216,7 @@ ES_Event RunFSMFindLine(ES_Event ThisEvent) {
                 case ES_ENTRY:
                     tank_turn_right();
                     if(get_front_tape_status() == TRUE) {
-                        printf("In FSM_find_line.c, turnRightState->ES_ENTRY->FRONT_TAPE_DECTECTED\r\n");
+                        ES_LOG0(LOG_FIND_LINE_FRONT);
                     }
                     break;
                 case TAPE_DETECTED:
@@ -198,11 +198,11 @@ ES_Event RunFSMLineFollower(ES_Event ThisEvent) {
                     switch (ThisEvent.EventParam) {
                         case RIGHT_TAPE_SENSOR:
 
-                            if (get_front_tape_status() == on_tape) {
+                            if (TAPE_EVENT_STATUS(ThisEvent, FRONT_TAPE_SENSOR) == on_tape) {
                                 nextState = corner_detected;
                                 makeTransition = TRUE;
                                 ThisEvent.EventType = ES_NO_EVENT;
-                            } else if (get_front_tape_status() == off_tape) {
+                            } else if (TAPE_EVENT_STATUS(ThisEvent, FRONT_TAPE_SENSOR) == off_tape) {
                                 nextState = on_left_side;
                                 makeTransition = TRUE;
                                 ThisEvent.EventType = ES_NO_EVENT;
@@ -211,7 +211,7 @@ ES_Event RunFSMLineFollower(ES_Event ThisEvent) {
 
                         case LEFT_TAPE_SENSOR:
 
-                            if (get_front_tape_status() == off_tape) {
+                            if (TAPE_EVENT_STATUS(ThisEvent, FRONT_TAPE_SENSOR) == off_tape) {
                                 nextState = on_right_side;
                                 makeTransition = TRUE;
                                 ThisEvent.EventType = ES_NO_EVENT;
@@ -228,8 +228,9 @@ ES_Event RunFSMLineFollower(ES_Event ThisEvent) {
                     switch (ThisEvent.EventParam) {
                         case CENTER_TAPE_SENSOR:
 
-                            if ((get_front_tape_status() == off_tape) && (get_left_tape_status() == off_tape) &&
-                                    (get_right_tape_status() == off_tape)) {
+                            if ((TAPE_EVENT_STATUS(ThisEvent, FRONT_TAPE_SENSOR) == off_tape) &&
+                                    (TAPE_EVENT_STATUS(ThisEvent, LEFT_TAPE_SENSOR) == off_tape) &&
+                                    (TAPE_EVENT_STATUS(ThisEvent, RIGHT_TAPE_SENSOR) == off_tape)) {
                                 //  LED_SetBank(LED_BANK3, 1);
                                 //LED_OffBank(LED_BANK2, ALL_LEDS);
 
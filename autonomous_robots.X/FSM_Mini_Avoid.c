@@ -385,7 +385,7 @@ ES_Event RunFSMMiniAvoid(ES_Event ThisEvent) {
                         case FRONT_TAPE_SENSOR:
                         case LEFT_TAPE_SENSOR:
                             if ((ES_Timer_GetTime() - start_time) > 1000 && ((ES_Timer_GetTime() - start_time) < 1800)) {
-                                printf("\r\nTIME IS:%d -------->>\r\n", ES_Timer_GetTime() - start_time);
+                                ES_LOG1(LOG_MINI_AVOID_TIME, ES_Timer_GetTime() - start_time);
                                 //1272
                                 //1653
                                 //1714
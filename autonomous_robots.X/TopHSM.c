@@ -55,6 +55,7 @@
 #define BOOT_TIME 100
 #define UNSTUCK_TIME 600
 #define RESET_BUMPER_COUNTER_TIME 7000
+#define DEFERRAL_QUEUE_SIZE 4 // events held for a later state
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
@@ -109,6 +110,10 @@ static int Last_Top_State = FindLineState;
 
 static TemplateHSMState_t CurrentState = InitPState; // <- change enum name to match ENUM
 static uint8_t MyPriority;
+// events that arrived in a state that could not act on them, recalled on
+// entry to the state that can
+ES_QUEUE_SIZE_CHECK(DeferralQueue, DEFERRAL_QUEUE_SIZE);
+static ES_Event DeferralQueue[DEFERRAL_QUEUE_SIZE + 1];
 
 /*******************************************************************************
  * PUBLIC FUNCTIONS                                                            *
@@ -132,6 +137,7 @@ uint8_t InitTopHSM(uint8_t Priority) {
     // put us into the Initial PseudoState
 
     CurrentState = InitPState;
+    ES_InitDeferralQueueWith(DeferralQueue, ARRAY_SIZE(DeferralQueue));
     // post the initial transition event
     if (ES_PostToService(MyPriority, INIT_EVENT) == TRUE) {
         return TRUE;
@@ -172,8 +178,31 @@ ES_Event RunTopHSM(ES_Event ThisEvent) {
     uint8_t makeTransition = FALSE; // use to flag transition
     TemplateHSMState_t nextState; // <- change type to correct enum
     int bumpers;
+#ifdef BATCH_TIMEOUT_EVENTS
+    uint16_t Expired;
+    uint8_t TimerNum;
+
+    // several of our timers ran out in the same tick: run each timeout
+    // through the machine in turn, as if they had been posted one by one
+    if (ThisEvent.EventType == ES_TIMEOUT_BATCH) {
+        Expired = ThisEvent.EventParam;
+        ThisEvent.EventType = ES_TIMEOUT;
+        for (TimerNum = 0; Expired != 0; TimerNum++, Expired >>= 1) {
+            if (Expired & 1) {
+                ThisEvent.EventParam = TimerNum;
+                RunTopHSM(ThisEvent);
+            }
+        }
+        return NO_EVENT;
+    }
+#endif
     ES_Tattle(); // trace call stack
 
+    // a deferred trackwire is only worth recalling while the wire is there
+    if (ThisEvent.EventType == TRACKWIRE_LOST) {
+        ES_ClearDeferralQueue(DeferralQueue);
+    }
+
     switch (CurrentState) {
         case InitPState: // If current state is initial Pseudo State
             switch (ThisEvent.EventType) {
@@ -239,7 +268,7 @@ ES_Event RunTopHSM(ES_Event ThisEvent) {
                     break;
                 default:
                     if (is_on_T() == TRUE) {
-                        printf("On T!!!\r\n");
+                        ES_LOG0(LOG_ON_T);
                     }
                     break;
             }
@@ -336,6 +365,8 @@ ES_Event RunTopHSM(ES_Event ThisEvent) {
                 case ES_ENTRY:
                     ES_Timer_InitTimer(RESET_BUMPER_COUNTER_TIMER, RESET_BUMPER_COUNTER_TIME);
                     InitFSMLineFollower(MyPriority);
+                    // handle a trackwire found while avoiding an obstacle
+                    ES_RecallEvents(MyPriority, DeferralQueue);
                     break;
             }
             ThisEvent = RunFSMLineFollower(ThisEvent);
@@ -422,13 +453,13 @@ ES_Event RunTopHSM(ES_Event ThisEvent) {
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
                 case GO_TO_FIND_LINE:
-                    printf("GO_TO_FIND_LINE\r\n");
+                    ES_LOG0(LOG_GO_TO_FIND_LINE);
                     nextState = FindLineState;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
                 case GO_TO_ON_LINE:
-                    printf("GO_TO_ON_LINE\r\n");
+                    ES_LOG0(LOG_GO_TO_ON_LINE);
                     nextState = LineFollowerState;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -578,6 +609,14 @@ ES_Event RunTopHSM(ES_Event ThisEvent) {
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
 
+                case TRACKWIRE_DETECTED:
+                    // can't align while avoiding, hold it for LineFollowerState
+                    if (ES_DeferEvent(DeferralQueue, ThisEvent) != TRUE) {
+                        ES_LOG0(LOG_DEFER_FULL);
+                    }
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+
                 case ES_NO_EVENT:
                 default:
                     break;
@@ -606,7 +645,7 @@ ES_Event RunTopHSM(ES_Event ThisEvent) {
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
                 case GO_TO_ON_LINE:
-                    printf("GO_TO_ON_LINE\r\n");
+                    ES_LOG0(LOG_GO_TO_ON_LINE);
                     nextState = LineFollowerState;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -625,9 +664,9 @@ ES_Event RunTopHSM(ES_Event ThisEvent) {
                         forwards();
                     } else if (are_front_bumpers_pressed() == TRUE) {
                         reverse();
-                        printf("Unstuck_state, front bumpers pressed reach if ---------->\r\n");
+                        ES_LOG0(LOG_UNSTUCK_FRONT);
                     } else {
-                        printf("Unstuck_state, reach else ---------->\r\n");
+                        ES_LOG0(LOG_UNSTUCK_ELSE);
                         turn_back_left();
                     }
 
@@ -664,6 +703,12 @@ ES_Event RunTopHSM(ES_Event ThisEvent) {
     } // end switch on Current State
 
     if (makeTransition == TRUE) { // making a state transition, send EXIT and ENTRY
+        // the deferred trackwire is recalled in LineFollowerState, drop it if
+        // we are leaving the way back there from MiniAvoidState
+        if ((nextState != MiniAvoidState) && (nextState != FindLineState) &&
+                (nextState != LineFollowerState)) {
+            ES_ClearDeferralQueue(DeferralQueue);
+        }
         // recursively call the current state with an exit event
         RunTopHSM(EXIT_EVENT); // <- rename to your own Run function
         adjust_pwm();
@@ -0,0 +1,68 @@
+/*
+ * File:   beacon_bearing.c
+ *
+ * Finds the centre of the beacon window during a sweep from the core timer
+ * counts of its two edges, which the beacon detector puts in the EventPayload
+ * of BEACON_FOUND and BEACON_LOST. All the times are 32 bit core timer counts,
+ * which wrap after about 107 s, far longer than a sweep.
+ */
+
+/*******************************************************************************
+ * MODULE #INCLUDE                                                             *
+ ******************************************************************************/
+
+#include <xc.h>
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "beacon_bearing.h"
+#include "beacon_detector.h"
+
+#ifndef USE_EVENT_PAYLOAD
+#error beacon_bearing needs USE_EVENT_PAYLOAD for the edge times
+#endif
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+#define CORE_TICKS_PER_MS (ES_TIMESTAMP_TICKS_PER_US * 1000)
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+static uint32_t RiseTime;
+static uint32_t FallTime;
+static uint8_t SeenRise;
+static uint8_t SeenWindow;
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+void beacon_bearing_start() {
+    SeenRise = FALSE;
+    SeenWindow = FALSE;
+}
+
+uint8_t beacon_bearing_edge(ES_Event ThisEvent) {
+    if (SeenWindow) {
+        return TRUE; // keep the first whole window of the sweep
+    }
+    if (ThisEvent.EventType == BEACON_FOUND) {
+        RiseTime = ThisEvent.EventPayload;
+        SeenRise = TRUE;
+    } else if ((ThisEvent.EventType == BEACON_LOST) && SeenRise) {
+        FallTime = ThisEvent.EventPayload;
+        SeenWindow = TRUE;
+    }
+    return SeenWindow;
+}
+
+uint32_t beacon_bearing_offset_ms() {
+    uint32_t Centre;
+
+    if (!SeenWindow) {
+        return 0;
+    }
+    Centre = RiseTime + (FallTime - RiseTime) / 2;
+    return (_CP0_GET_COUNT() - Centre) / CORE_TICKS_PER_MS;
+}
@@ -0,0 +1,48 @@
+/*
+ * File:   beacon_bearing.h
+ *
+ * Beacon bearing from the timing of a sweep. While the robot turns at a steady
+ * rate, the beacon is seen from its rising (BEACON_FOUND) edge to its falling
+ * (BEACON_LOST) edge, and the beacon itself is in the middle of that window.
+ * The edge times come from the interrupt driven detector, so the detection
+ * latency is the same on both edges and drops out of the centre.
+ */
+
+#ifndef BEACON_BEARING_H
+#define	BEACON_BEARING_H
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Events.h"
+
+/*******************************************************************************
+ * PUBLIC FUNCTION PROTOTYPES                                                  *
+ ******************************************************************************/
+
+/**
+ * @Function beacon_bearing_start(void)
+ * @param None.
+ * @return None.
+ * @brief  Starts a new sweep and forgets the last window. If the beacon is
+ *         already in view its rising edge has been missed, so that window is
+ *         not used and the sweep goes on to the next one. */
+void beacon_bearing_start();
+
+/**
+ * @Function beacon_bearing_edge(ES_Event ThisEvent)
+ * @param ThisEvent - a BEACON_FOUND or BEACON_LOST from the beacon detector
+ * @return TRUE once the sweep has seen a whole window, else FALSE
+ * @brief  Notes the edge time carried in the event. A BEACON_LOST with no
+ *         BEACON_FOUND before it in this sweep is ignored. */
+uint8_t beacon_bearing_edge(ES_Event ThisEvent);
+
+/**
+ * @Function beacon_bearing_offset_ms(void)
+ * @param None.
+ * @return how long ago the robot was pointing at the centre of the window, in
+ *         ms, or 0 if there is no window yet
+ * @brief  Turning back the other way for this long at the sweep rate puts
+ *         the robot on the beacon. */
+uint32_t beacon_bearing_offset_ms();
+
+#endif	/* BEACON_BEARING_H */
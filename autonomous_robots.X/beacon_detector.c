@@ -0,0 +1,148 @@
+/*
+ * File:   beacon_detector.c
+ *
+ * Interrupt driven beacon input, in place of polling the pin from the idle
+ * loop. The input capture interrupt takes the time of every edge and
+ * (re)starts BEACON_HR_TIMER; when the timer runs out the new level has held
+ * for BEACON_MIN_PULSE_US and is published straight from the interrupt. A
+ * glitch shorter than that puts the pin back before the timer is up, so
+ * nothing is posted. The detection latency is the pulse width plus the time
+ * to get through the ISR ring and the TopHSM queue, no matter how busy the
+ * idle loop is. The worst case during the tank_turn_right() sweep has not
+ * been measured yet: build with PRINT_BEACON_LATENCY and read the figures
+ * that FindBeacon logs on exit.
+ *
+ * Both interrupts run at priority 4, so the edge state is never changed
+ * under the other one, and the posts go through the level 4 ISR ring.
+ */
+
+/*******************************************************************************
+ * MODULE #INCLUDE                                                             *
+ ******************************************************************************/
+
+#include <xc.h>
+#include <sys/attribs.h>
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "beacon_detector.h"
+#include "TopHSM.h"
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+#define BEACON_IC_IPL 4 // same as the HR timers
+// IC4 in edge detect mode, an interrupt on every rising and falling edge. The
+// captured Timer2 count is not used, the edge is timed by the core timer.
+#define BEACON_IC_MODE 1
+#define BEACON_MIN_PULSE_TICKS (BEACON_MIN_PULSE_US / ES_HR_TICK_US)
+
+#define ReadBeaconLevel() \
+    (((IO_PortsReadPort(BEACON_PORT) & BEACON_SIGNAL_PIN) == BEACON_SIGNAL_PIN) ? \
+    BEACON_NOT_FOUND_STATE : BEACON_FOUND_STATE)
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+// level after the last edge, and the core timer count when it happened
+static volatile int EdgeLevel;
+static volatile uint32_t EdgeTime;
+// level last posted
+static volatile int ReportedLevel;
+
+// edge to post, and edge to handled by the state machine, in core ticks
+static uint32_t PostLatencyMax;
+static uint32_t HandledLatencyMax;
+static uint64_t HandledLatencyTotal;
+static uint32_t HandledCount;
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+void beacon_init() {
+    IO_PortsSetPortInputs(BEACON_PORT, BEACON_SIGNAL_PIN);
+    IEC0CLR = _IEC0_IC4IE_MASK;
+    IC4CON = 0;
+    EdgeLevel = ReadBeaconLevel();
+    ReportedLevel = EdgeLevel;
+    EdgeTime = _CP0_GET_COUNT();
+    IC4CONbits.ICTMR = 1; // Timer2, already running for the PWM
+    IC4CONbits.ICM = BEACON_IC_MODE;
+    IPC4bits.IC4IP = BEACON_IC_IPL;
+    IFS0CLR = _IFS0_IC4IF_MASK;
+    IC4CONbits.ON = 1;
+    IEC0SET = _IEC0_IC4IE_MASK;
+}
+
+int get_beacon_status() {
+    return ReportedLevel;
+}
+
+uint8_t BeaconPulseConfirmed(ES_Event ThisEvent) {
+    ES_Event BeaconEvent;
+    uint32_t Latency;
+
+    if (EdgeLevel == ReportedLevel) {
+        return TRUE; // it went back again within the pulse width
+    }
+    ReportedLevel = EdgeLevel;
+    BeaconEvent.EventType = (ReportedLevel == BEACON_FOUND_STATE) ? BEACON_FOUND : BEACON_LOST;
+    BeaconEvent.EventParam = 0;
+#ifdef USE_EVENT_PAYLOAD
+    BeaconEvent.EventPayload = EdgeTime;
+#endif
+    ES_Publish(BeaconEvent);
+    Latency = _CP0_GET_COUNT() - EdgeTime;
+    if (Latency > PostLatencyMax) {
+        PostLatencyMax = Latency;
+    }
+    return TRUE;
+}
+
+void beacon_note_handled(ES_Event ThisEvent) {
+#ifdef USE_EVENT_PAYLOAD
+    uint32_t Latency = _CP0_GET_COUNT() - ThisEvent.EventPayload;
+
+    HandledCount++;
+    HandledLatencyTotal += Latency;
+    if (Latency > HandledLatencyMax) {
+        HandledLatencyMax = Latency;
+    }
+#endif
+}
+
+void beacon_print_latency() {
+    ES_LOG4(LOG_BEACON_LATENCY, PostLatencyMax / ES_TIMESTAMP_TICKS_PER_US,
+            HandledCount ? (uint32_t) ((HandledLatencyTotal / HandledCount) / ES_TIMESTAMP_TICKS_PER_US) : 0,
+            HandledLatencyMax / ES_TIMESTAMP_TICKS_PER_US, HandledCount);
+    PostLatencyMax = 0;
+    HandledLatencyMax = 0;
+    HandledLatencyTotal = 0;
+    HandledCount = 0;
+}
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+/**
+ * @Function BeaconEdgeIntHandler(void)
+ * @param None.
+ * @return None.
+ * @brief  input capture on the beacon pin: notes the new level and the time,
+ *         and starts the pulse width over. The capture buffer is emptied so
+ *         it can never overflow and stop the captures. */
+void __ISR(_INPUT_CAPTURE_4_VECTOR, ipl4auto) BeaconEdgeIntHandler(void) {
+    uint32_t Now = _CP0_GET_COUNT();
+    int Level = ReadBeaconLevel();
+
+    while (IC4CONbits.ICBNE) {
+        (void) IC4BUF;
+    }
+    IFS0CLR = _IFS0_IC4IF_MASK;
+    if (Level != EdgeLevel) {
+        EdgeLevel = Level;
+        EdgeTime = Now;
+        ES_HRTimer_InitTimer(BEACON_HR_TIMER, BEACON_MIN_PULSE_TICKS);
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * File:   beacon_detector.h
+ *
+ * Interrupt driven beacon input. The beacon detector output is on an input
+ * capture pin and raises an interrupt on every edge; an edge that is still
+ * there after
+ * BEACON_MIN_PULSE_US is published as BEACON_FOUND or BEACON_LOST,
+ * with the core timer count of the edge in the EventPayload.
+ */
+
+#ifndef BEACON_DETECTOR_H
+#define	BEACON_DETECTOR_H
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Events.h"
+#include "IO_Ports.h"
+
+/*******************************************************************************
+ * PUBLIC #DEFINES                                                             *
+ ******************************************************************************/
+// the detector output has to be on an input capture pin. WIRING CHANGE: it
+// moves from PORTZ-03, where it was polled, to PORTY-03, which is RD11 and
+// IC4. The other capture pins are taken: RD8 (PORTZ-08, IC1) is
+// COIL_B_ENABLE in Stepper.h and RD9 (PORTY-08, IC2) is the tape sensor LED.
+// RD10 (PORTY-06, IC3) is also free but is kept for RC_PORTY06.
+#define BEACON_PORT PORTY
+#define BEACON_SIGNAL_PIN PIN3
+
+#define BEACON_FOUND_STATE 0
+#define BEACON_NOT_FOUND_STATE 1
+
+// an edge has to hold this long to count, shorter pulses are motor noise
+#define BEACON_MIN_PULSE_US 100
+
+/*******************************************************************************
+ * PUBLIC FUNCTION PROTOTYPES                                                  *
+ ******************************************************************************/
+
+/**
+ * @Function beacon_init(void)
+ * @param None.
+ * @return None.
+ * @brief  Makes the beacon pin an input and turns on its input capture
+ *         interrupt. The level at start up counts as already reported, the
+ *         first event is posted on the first real edge.
+ * @note   Call it after ES_Initialize, an edge restarts BEACON_HR_TIMER and
+ *         posts through the ISR rings, which ES_Initialize sets up. */
+void beacon_init();
+
+/**
+ * @Function get_beacon_status(void)
+ * @param None.
+ * @return BEACON_FOUND_STATE or BEACON_NOT_FOUND_STATE, as last posted
+ * @brief  the filtered level, so it always agrees with the last beacon event */
+int get_beacon_status();
+
+/**
+ * @Function BeaconPulseConfirmed(ES_Event ThisEvent)
+ * @param ThisEvent - the ES_HR_TIMEOUT of BEACON_HR_TIMER
+ * @return TRUE
+ * @brief  Not for calling directly, it is the post function of BEACON_HR_TIMER.
+ *         Posts the beacon event if the level still differs from the one last
+ *         posted when the minimum pulse width is up. */
+uint8_t BeaconPulseConfirmed(ES_Event ThisEvent);
+
+/**
+ * @Function beacon_note_handled(ES_Event ThisEvent)
+ * @param ThisEvent - a BEACON_FOUND or BEACON_LOST as it reached a state machine
+ * @return None.
+ * @brief  Adds the time from the edge to now to the detection latency
+ *         figures. Call it where the event is acted on. */
+void beacon_note_handled(ES_Event ThisEvent);
+
+/**
+ * @Function beacon_print_latency(void)
+ * @param None.
+ * @return None.
+ * @brief  prints the worst and mean time from a beacon edge to its event being
+ *         posted and to it being handled, then starts the figures again.
+ *         Goes through the deferred log. */
+void beacon_print_latency();
+
+#endif	/* BEACON_DETECTOR_H */
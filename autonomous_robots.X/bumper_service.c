@@ -44,13 +44,18 @@
 
 
 #define TIMER_BUMPER_TICKS 3 //100Hz (More than enough))
+#ifdef USE_PERIODIC_TASKS
+#define BUMPER_PERIOD_US (BUMPER_TASK_PERIOD * ES_TASK_TICK_US)
+#else
+#define BUMPER_PERIOD_US (TIMER_BUMPER_TICKS * 1000)
+#endif
+#define BUMPER_PERIOD_BIN_US 50
 
 /*******************************************************************************
  * PRIVATE FUNCTION PROTOTYPES                                                 *
  ******************************************************************************/
 /* Prototypes for private functions for this machine. They should be functions
    relevant to the behavior of this state machine */
-uint8_t CheckBumpers(void);
 /*******************************************************************************
  * PRIVATE MODULE VARIABLES                                                    *
  ******************************************************************************/
@@ -90,7 +95,12 @@ typedef union {
 
 Bumper_Bank_t all_bumpers;
 
+#ifndef USE_PERIODIC_TASKS
 static uint8_t MyPriority;
+#endif
+#ifdef USE_PERIOD_HISTOGRAMS
+static ES_Histogram_t BumperPeriod;
+#endif
 
 /*******************************************************************************
  * PUBLIC FUNCTIONS                                                            *
@@ -114,6 +124,24 @@ int are_front_bumpers_pressed() {
 
 }
 
+/**
+ * @Function get_bumper_bank(void)
+ * @param None.
+ * @return the debounced bumper state, one *_PIN bit set per pressed bumper
+ * @brief  Same bit layout as BUMPER_PRESSED's parameter. */
+int get_bumper_bank() {
+    int bank = 0;
+
+    if (Front_Left_Pressed_Flag == TRUE) bank |= FRONT_LEFT_BUMPER_PIN;
+    if (Front_Right_Pressed_Flag == TRUE) bank |= FRONT_RIGHT_BUMPER_PIN;
+    if (Rear_Left_Pressed_Flag == TRUE) bank |= BACK_LEFT_BUMPER_PIN;
+    if (Rear_Right_Pressed_Flag == TRUE) bank |= BACK_RIGHT_BUMPER_PIN;
+    if (Ren_Left_Pressed_Flag == TRUE) bank |= REN_LEFT_PIN;
+    if (Ren_Center_Pressed_Flag == TRUE) bank |= REN_CENTER_PIN;
+    if (Ren_Right_Pressed_Flag == TRUE) bank |= REN_RIGHT_PIN;
+    return bank;
+}
+
 int are_rear_bumpers_pressed() {
     if ((Rear_Right_Pressed_Flag == TRUE) ||
             (Rear_Left_Pressed_Flag == TRUE) 
@@ -124,6 +152,22 @@ int are_rear_bumpers_pressed() {
 
 }
 
+/**
+ * @Function init_bumpers(void)
+ * @param None.
+ * @return None.
+ * @brief  Makes the bumper pins inputs and sets up the sample period
+ *         histogram. Call it from main before ES_Initialize, which starts
+ *         CheckBumpers from the task table or the bumper service timer. */
+void init_bumpers() {
+#ifdef USE_PERIOD_HISTOGRAMS
+    ES_Histogram_Init(&BumperPeriod, "bumper", BUMPER_PERIOD_US,
+            BUMPER_PERIOD_BIN_US);
+#endif
+    IO_PortsSetPortInputs(BUMPER_PORT, ALL_BUMPER_PINS);
+}
+
+#ifndef USE_PERIODIC_TASKS
 /**
  * @Function InitTemplateService(uint8_t Priority)
  * @param Priority - internal variable to track which event queue to use
@@ -145,14 +189,10 @@ uint8_t InitBumperService(uint8_t Priority) {
 
     // post the initial transition event
 
-    ES_Timer_InitTimer(BUMPER_SENSOR_TIMER, TIMER_BUMPER_TICKS);
-
-    //Initialize Bumper
-
-    IO_PortsSetPortInputs(BUMPER_PORT, ALL_BUMPER_PINS);
-
-
-
+    // reloaded by the timer ISR, so the samples stay evenly spaced however
+    // long the timeouts wait in the queue. With the periodic tasks there is
+    // no service and CheckBumpers is run from the task table instead.
+    ES_Timer_InitPeriodicTimer(BUMPER_SENSOR_TIMER, TIMER_BUMPER_TICKS);
 
     ThisEvent.EventType = ES_INIT;
     if (ES_PostToService(MyPriority, ThisEvent) == TRUE) {
@@ -204,19 +244,13 @@ ES_Event RunBumperService(ES_Event ThisEvent) {
             break;
 
         case ES_TIMEOUT:
-            ES_Timer_InitTimer(BUMPER_SENSOR_TIMER, TIMER_BUMPER_TICKS);
-
-
-
-
-            all_bumpers.value = read_all_bumpers();
-
             CheckBumpers();
             break;
     }
 
     return ReturnEvent;
 }
+#endif
 
 /*******************************************************************************
  * PRIVATE FUNCTIONs                                                           *
@@ -240,7 +274,7 @@ int checkBumper(int* flag, int counter, int param) {
         //thisEvent.EventParam = param;
         thisEvent.EventParam = all_bumpers.value & ALL_BIG_BUMPERS;
         returnVal = TRUE;
-        PostTopHSM(thisEvent);
+        ES_Publish(thisEvent);
 
     } else if ((*flag == TRUE) &&(counter < (-MAX_HISTORY_SIZE) + 2)) {
         *flag = FALSE;
@@ -249,7 +283,7 @@ int checkBumper(int* flag, int counter, int param) {
         // thisEvent.EventParam = param;
         thisEvent.EventParam = all_bumpers.value & ALL_BIG_BUMPERS;
         returnVal = TRUE;
-        PostTopHSM(thisEvent);
+        ES_Publish(thisEvent);
 
     }
     return returnVal;
@@ -264,7 +298,7 @@ int checkRenBumper(int* flag, int counter, int param) {
         thisEvent.EventParam = param;
         //thisEvent.EventParam = all_bumpers.value & ALL_REN_BUMPERS;
         returnVal = TRUE;
-        PostTopHSM(thisEvent);
+        ES_Publish(thisEvent);
 
     } else if ((*flag == TRUE) &&(counter < (-MAX_HISTORY_SIZE) + 2)) {
         *flag = FALSE;
@@ -273,7 +307,7 @@ int checkRenBumper(int* flag, int counter, int param) {
         thisEvent.EventParam = param;
         //thisEvent.EventParam = all_bumpers.value & ALL_REN_BUMPERS;
         returnVal = TRUE;
-        PostTopHSM(thisEvent);
+        ES_Publish(thisEvent);
 
     }
     return returnVal;
@@ -305,6 +339,10 @@ uint8_t CheckBumpers(void) {
     static int Center_Ren_Bumper_Pressed_Counter = 0;
     static int Right_Ren_Bumper_Pressed_Counter = 0;
 
+#ifdef USE_PERIOD_HISTOGRAMS
+    ES_Histogram_Mark(&BumperPeriod);
+#endif
+    all_bumpers.value = read_all_bumpers();
 
     if (ReadFrontRightBumper() == BUMPER_TRIPPED) {
         if (Front_Right_Pressed_Counter < MAX_HISTORY_SIZE - 1) {
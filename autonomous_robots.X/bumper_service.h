@@ -55,7 +55,16 @@
  * PUBLIC FUNCTION PROTOTYPES                                                  *
  ******************************************************************************/
 int are_bumpers_ren_aligned();
- 
+
+/**
+ * @Function init_bumpers(void)
+ * @param None.
+ * @return None.
+ * @brief  Makes the bumper pins inputs and sets up the sample period
+ *         histogram. Call it from main before ES_Initialize. */
+void init_bumpers();
+
+#ifndef USE_PERIODIC_TASKS
 /**
  * @Function InitTemplateService(uint8_t Priority)
  * @param Priority - internal variable to track which event queue to use
@@ -89,10 +98,24 @@ uint8_t PostBumperService(ES_Event ThisEvent);
  *       Returns ES_NO_EVENT if the event have been "consumed." 
  * @author J. Edward Carryer, 2011.10.23 19:25 */
 ES_Event RunBumperService(ES_Event ThisEvent);
+#endif
 
 
 int are_front_bumpers_pressed();
 
 int are_rear_bumpers_pressed();
+
+int get_bumper_bank();
+
+/**
+ * @Function CheckBumpers(void)
+ * @param None.
+ * @return TRUE if a bumper event was posted
+ * @brief  Reads the bumper port and debounces every bumper, posting
+ *         BUMPER_PRESSED/BUMPER_RELEASED and the REN_ ones to TopHSM when a
+ *         bumper settles into its other state. Run every TIMER_BUMPER_TICKS
+ *         ms, from the periodic task table with USE_PERIODIC_TASKS and from
+ *         the bumper service timeout otherwise. */
+uint8_t CheckBumpers(void);
 #endif /* TemplateService_H */
 
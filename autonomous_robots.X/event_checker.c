@@ -29,23 +29,21 @@
 #include "ES_Configure.h"
 #include "event_checker.h"
 #include "ES_Events.h"
+#include "ES_Framework.h"
+#include "ES_Hysteresis.h"
 #include "serial.h"
 #include "AD.h"
 #include <stdio.h>
 #include "TopHSM.h"
 #include "IO_Ports.h"
+#include "trackwire.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
-#define TRACKWIRE_ALIGNED_THRESHOLD 20
 #define TRACKWIRE_DETECTED_THRESHOLD 600
 #define TRACKWIRE_LOST_THRESHOLD 500
 
-//beacon defines 
-#define BEACON_PORT PORTZ
-#define BEACON_SIGNAL_PIN PIN3
-
 
 /*******************************************************************************
  * EVENTCHECKER_TEST SPECIFIC CODE                                                             *
@@ -78,53 +76,26 @@ static ES_Event storedEvent;
  * PUBLIC FUNCTIONS                                                            *
  ******************************************************************************/
 
-
-static uint16_t beacon_signal;
-
-int get_beacon_status(){
-    return beacon_signal;
-}
-
-
-uint8_t BeaconDetectorChecker() {
-    static ES_EventTyp_t lastEvent = BEACON_LOST;
-    static ES_EventTyp_t curEvent = BEACON_LOST;
-    ES_Event thisEvent;
-    uint8_t returnVal = FALSE;
-
-    if ((IO_PortsReadPort(PORTZ) & BEACON_SIGNAL_PIN) == BEACON_SIGNAL_PIN) {
-        beacon_signal = 1;
-    } else {
-
-        beacon_signal = 0;
-    }
-    if ((curEvent == BEACON_LOST) && (beacon_signal == BEACON_FOUND_STATE)) {
-        curEvent = BEACON_FOUND;
-
-    } else if ((curEvent == BEACON_FOUND) && (beacon_signal == BEACON_NOT_FOUND_STATE)) {
-        curEvent = BEACON_LOST;
-    }
-
-    if (curEvent != lastEvent) {
-        thisEvent.EventType = curEvent;
-        thisEvent.EventParam = 0;
-        returnVal = TRUE;
-        PostTopHSM(thisEvent);
-        lastEvent = curEvent;
-    }
-
-
-
-
-    return (returnVal);
-
-}
 static ES_EventTyp_t curEvent = TRACKWIRE_LOST;
+static int16_t lastTrackwireDiff = 0;
+
+// the wire is there once both coils read over TRACKWIRE_DETECTED_THRESHOLD and
+// gone once either reads under TRACKWIRE_LOST_THRESHOLD, so the channel is
+// fed the weaker of the two
+static const ES_HystChannel_t TrackwireChannels[] = {
+    {TRACKWIRE_DETECTED_THRESHOLD, TRACKWIRE_LOST_THRESHOLD, 1, TRACKWIRE_DETECTED, TRACKWIRE_LOST, 0},
+};
+static ES_Hysteresis_t TrackwireHysteresis;
 
 ES_EventTyp_t get_track_wire_state() {
     return curEvent;
 }
 
+// filtered front minus back trackwire reading from the last TrackwireChecker() run
+int16_t get_trackwire_diff() {
+    return lastTrackwireDiff;
+}
+
 /**
  * @Function TemplateCheckBattery(void)
  * @param none
@@ -139,6 +110,8 @@ ES_EventTyp_t get_track_wire_state() {
  * @note Use this code as a template for your other event checkers, and modify as necessary.
  * @author Gabriel H Elkaim, 2013.09.27 09:18
  * @modified Gabriel H Elkaim/Max Dunne, 2016.09.12 20:08 */
+// with USE_PERIODIC_TASKS this runs from the task table at priority 4,
+// in the Timer5 interrupt or any caller of ES_HRTimer_*, so it must not print
 uint8_t TrackwireChecker(void) {
     //static ES_EventTyp_t lastEvent = TRACKWIRE_LOST;
 
@@ -151,55 +124,31 @@ uint8_t TrackwireChecker(void) {
         return returnVal;
     }
 
-    int diff = front_trackwire_val - back_trackwire_val;
-
-    switch (curEvent) {
-        case TRACKWIRE_LOST:
-            if ((front_trackwire_val > TRACKWIRE_DETECTED_THRESHOLD) &&
-                    (back_trackwire_val > TRACKWIRE_DETECTED_THRESHOLD)) {
-
-                curEvent = TRACKWIRE_DETECTED;
-                thisEvent.EventType = curEvent;
-                thisEvent.EventParam = diff;
-                returnVal = TRUE;
-                printf("TRACKWIRE_DETECTED\r\n");
-                PostTopHSM(thisEvent);
-            }
-            break;
-
-        case TRACKWIRE_DETECTED:
-            if ((front_trackwire_val < TRACKWIRE_LOST_THRESHOLD) ||
-                    (back_trackwire_val < TRACKWIRE_LOST_THRESHOLD)) {
-                curEvent = TRACKWIRE_LOST;
-                thisEvent.EventType = curEvent;
-                thisEvent.EventParam = diff;
-                returnVal = TRUE;
-                printf("TRACKWIRE_LOST\r\n");
-                PostTopHSM(thisEvent);
-            } else if ((diff < TRACKWIRE_ALIGNED_THRESHOLD) && (diff > -TRACKWIRE_ALIGNED_THRESHOLD)) {
-                curEvent = TRACKWIRE_ALIGNED;
-                thisEvent.EventType = curEvent;
-                thisEvent.EventParam = diff;
-                returnVal = TRUE;
-                printf("TRACKWIRE_ALIGNED\r\n");
-                PostTopHSM(thisEvent);
-            }
-            break;
-
-        case TRACKWIRE_ALIGNED:
-            if ((front_trackwire_val < TRACKWIRE_LOST_THRESHOLD) ||
-                    (back_trackwire_val < TRACKWIRE_LOST_THRESHOLD)) {
-
-                curEvent = TRACKWIRE_LOST;
-                thisEvent.EventType = curEvent;
-                thisEvent.EventParam = diff;
-                returnVal = TRUE;
-                printf("TRACKWIRE_LOST2\r\n");
-                PostTopHSM(thisEvent);
-            }
-
+    trackwire_update(front_trackwire_val, back_trackwire_val);
+    front_trackwire_val = trackwire_get_front();
+    back_trackwire_val = trackwire_get_back();
 
-            break;
+    int diff = front_trackwire_val - back_trackwire_val;
+    int16_t strength = (front_trackwire_val < back_trackwire_val) ? front_trackwire_val : back_trackwire_val;
+    lastTrackwireDiff = diff;
+
+    // found or lost, with the difference in the payload
+    if (ES_Hysteresis_Update(&TrackwireHysteresis, &strength) != 0) {
+        curEvent = (ES_Hysteresis_GetState(&TrackwireHysteresis, 0) == ES_HYST_IN) ?
+                TRACKWIRE_DETECTED : TRACKWIRE_LOST;
+        if (curEvent == TRACKWIRE_DETECTED) {
+            trackwire_reset_peak(); // look for the peak of this pass over the wire
+        }
+        ES_Hysteresis_Post(&TrackwireHysteresis, 1, (uint16_t) diff);
+        return TRUE;
+    }
+    // aligned once, until the wire is lost again, with the error as the param
+    if ((curEvent == TRACKWIRE_DETECTED) && trackwire_is_aligned()) {
+        curEvent = TRACKWIRE_ALIGNED;
+        thisEvent.EventType = curEvent;
+        thisEvent.EventParam = trackwire_get_error();
+        returnVal = TRUE;
+        ES_Publish(thisEvent);
     }
 
 
@@ -227,13 +176,11 @@ uint8_t TrackwireChecker(void) {
 
 void trackwire_init() {
     AD_AddPins(FRONT_TRACKWIRE_PIN | BACK_TRACKWIRE_PIN);
+    ES_Hysteresis_Init(&TrackwireHysteresis, TrackwireChannels, ARRAY_SIZE(TrackwireChannels),
+            ES_Publish, ES_HYST_OUT);
     uint16_t front_trackwire_val = AD_ReadADPin(FRONT_TRACKWIRE_PIN);
     uint16_t back_trackwire_val = AD_ReadADPin(BACK_TRACKWIRE_PIN);
 }
-
-void beacon_init() {
-    IO_PortsSetPortInputs(BEACON_PORT, BEACON_SIGNAL_PIN);
-}
 /* 
  * The Test Harness for the event checkers is conditionally compiled using
  * the EVENTCHECKER_TEST macro (defined either in the file or at the project level).
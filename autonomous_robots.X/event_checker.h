@@ -28,6 +28,7 @@
 
 #include "ES_Configure.h"   // defines ES_Event, INIT_EVENT, ENTRY_EVENT, and EXIT_EVENT
 #include "BOARD.h"
+#include "beacon_detector.h" // the beacon used to be polled from here
 
 /*******************************************************************************
  * PUBLIC #DEFINES                                                             *
@@ -35,9 +36,6 @@
 #define FRONT_TRACKWIRE_PIN AD_PORTV3
 #define BACK_TRACKWIRE_PIN AD_PORTV4
 
-
-#define BEACON_FOUND_STATE 0
-#define BEACON_NOT_FOUND_STATE 1
 /*******************************************************************************
  * PUBLIC TYPEDEFS                                                             *
  ******************************************************************************/
@@ -62,11 +60,8 @@
  * @author Gabriel H Elkaim, 2013.09.27 09:18
  * @modified Gabriel H Elkaim/Max Dunne, 2016.09.12 20:08 */
 uint8_t TrackwireChecker(void);
-int get_beacon_status();
 ES_EventTyp_t get_track_wire_state();
+int16_t get_trackwire_diff();
 void trackwire_init();
 
-uint8_t BeaconDetectorChecker();
-void beacon_init();
-
 #endif	/* TEMPLATEEVENTCHECKER_H */
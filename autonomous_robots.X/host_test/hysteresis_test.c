@@ -0,0 +1,207 @@
+/*
+ * File:   hysteresis_test.c
+ *
+ * Host test for ES_Hysteresis.c. Checks the state changes and the events
+ * posted for channels entered going up and going down, with and without
+ * debounce, then times ES_Hysteresis_Update on 8 channels swept through both
+ * levels, the same load as TEST_HYSTERESIS_BENCHMARK in main.c. The rate is
+ * the host's and says nothing about the PIC32.
+ *
+ * Build and run with "make -C host_test" from autonomous_robots.X, or
+ *   gcc -std=gnu99 -O2 -Wall -I. -Ihost_test/stubs \
+ *       host_test/hysteresis_test.c ES_Hysteresis.c -o hysteresis_test
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "ES_Configure.h"
+#include "ES_Hysteresis.h"
+#include <BOARD.h>
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+#define MAX_POSTS 16
+#define BENCHMARK_PASSES 1000000
+#define BENCHMARK_CHANNELS 8
+#define BENCHMARK_STEPS 16
+#define BENCH_LOW 300
+#define BENCH_HIGH 400
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+static ES_Event posts[MAX_POSTS];
+static int num_posts;
+static int failures;
+
+// 0: trackwire style, in above 400, out below 300, at once
+// 1: tape style, in below 300, out above 400, after 3 readings
+static const ES_HystChannel_t test_channels[] = {
+    {400, 300, 0, TRACKWIRE_DETECTED, TRACKWIRE_LOST, 10},
+    {300, 400, 3, TAPE_DETECTED, TAPE_LOST, 11},
+};
+
+#define BENCH_CHANNEL(index) {BENCH_LOW, BENCH_HIGH, 1, TAPE_DETECTED, TAPE_LOST, index}
+
+static const ES_HystChannel_t bench_channels[BENCHMARK_CHANNELS] = {
+    BENCH_CHANNEL(0), BENCH_CHANNEL(1), BENCH_CHANNEL(2), BENCH_CHANNEL(3),
+    BENCH_CHANNEL(4), BENCH_CHANNEL(5), BENCH_CHANNEL(6), BENCH_CHANNEL(7),
+};
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+static void check(int cond, const char *text, int line) {
+    if (!cond) {
+        printf("FAIL line %d: %s\n", line, text);
+        failures++;
+    }
+}
+
+static uint8_t record_post(ES_Event event) {
+    if (num_posts < MAX_POSTS) {
+        posts[num_posts] = event;
+    }
+    num_posts++;
+    return TRUE;
+}
+
+static uint8_t count_post(ES_Event event) {
+    num_posts++;
+    return TRUE;
+}
+
+static uint32_t feed(ES_Hysteresis_t *hyst, int16_t value0, int16_t value1) {
+    int16_t values[2];
+
+    values[0] = value0;
+    values[1] = value1;
+    return ES_Hysteresis_Update(hyst, values);
+}
+
+static void test_levels(void) {
+    ES_Hysteresis_t hyst;
+
+    CHECK(ES_Hysteresis_Init(&hyst, test_channels, 2, record_post, ES_HYST_UNKNOWN) == TRUE);
+    CHECK(ES_Hysteresis_Init(&hyst, bench_channels, ES_HYSTERESIS_MAX_CHANNELS + 1,
+            record_post, ES_HYST_UNKNOWN) == FALSE);
+    CHECK(ES_Hysteresis_Init(&hyst, test_channels, 2, record_post, ES_HYST_UNKNOWN) == TRUE);
+
+    // between the levels stays unknown
+    CHECK(feed(&hyst, 350, 350) == 0);
+    CHECK(ES_Hysteresis_GetState(&hyst, 0) == ES_HYST_UNKNOWN);
+
+    // channel 0 goes in at once, channel 1 needs three readings in a row
+    CHECK(feed(&hyst, 401, 299) == 0x1);
+    CHECK(ES_Hysteresis_GetState(&hyst, 0) == ES_HYST_IN);
+    CHECK(feed(&hyst, 401, 299) == 0);
+    CHECK(feed(&hyst, 401, 350) == 0); // back between, count starts over
+    CHECK(feed(&hyst, 401, 299) == 0);
+    CHECK(feed(&hyst, 401, 299) == 0);
+    CHECK(feed(&hyst, 401, 299) == 0x2);
+    CHECK(ES_Hysteresis_GetState(&hyst, 1) == ES_HYST_IN);
+
+    // the compares are strict, on a level is not past it
+    CHECK(feed(&hyst, 300, 400) == 0);
+    CHECK(feed(&hyst, 299, 401) == 0x1);
+    CHECK(ES_Hysteresis_GetState(&hyst, 0) == ES_HYST_OUT);
+    CHECK(feed(&hyst, 299, 401) == 0);
+    CHECK(feed(&hyst, 299, 401) == 0x2);
+    CHECK(ES_Hysteresis_GetState(&hyst, 1) == ES_HYST_OUT);
+}
+
+static void test_post(void) {
+    ES_Hysteresis_t hyst;
+    int16_t values[2] = {500, 100};
+
+    ES_Hysteresis_Init(&hyst, test_channels, 2, record_post, ES_HYST_OUT);
+    num_posts = 0;
+    CHECK(ES_Hysteresis_Run(&hyst, values, 0x12345678) == TRUE);
+    CHECK(num_posts == 1); // channel 1 is still debouncing
+    CHECK(posts[0].EventType == TRACKWIRE_DETECTED);
+    CHECK(posts[0].EventParam == 10);
+#ifdef USE_EVENT_PAYLOAD
+    CHECK(posts[0].EventPayload == 0x12345678);
+#endif
+    ES_Hysteresis_Run(&hyst, values, 0);
+    CHECK(ES_Hysteresis_Run(&hyst, values, 0) == TRUE);
+    CHECK(num_posts == 2);
+    CHECK(posts[1].EventType == TAPE_DETECTED);
+    CHECK(posts[1].EventParam == 11);
+
+    // and out again, channel 1 on its third reading
+    values[0] = 0;
+    values[1] = 1000;
+    CHECK(ES_Hysteresis_Run(&hyst, values, 0) == TRUE);
+    CHECK(ES_Hysteresis_Run(&hyst, values, 0) == FALSE);
+    CHECK(ES_Hysteresis_Run(&hyst, values, 0) == TRUE);
+    CHECK(num_posts == 4);
+    CHECK(posts[2].EventType == TRACKWIRE_LOST);
+    CHECK(posts[3].EventType == TAPE_LOST);
+    CHECK(posts[3].EventParam == 11);
+}
+
+static void test_post_order(void) {
+    ES_Hysteresis_t hyst;
+    int16_t values[BENCHMARK_CHANNELS] = {500, 100, 500, 100, 500, 100, 500, 100};
+
+    // channels that change on the same reading are posted lowest first
+    ES_Hysteresis_Init(&hyst, bench_channels, BENCHMARK_CHANNELS, record_post, ES_HYST_UNKNOWN);
+    num_posts = 0;
+    CHECK(ES_Hysteresis_Update(&hyst, values) == 0xFF);
+    CHECK(ES_Hysteresis_Post(&hyst, 0xA5, 0) == TRUE);
+    CHECK(num_posts == 4);
+    CHECK((posts[0].EventParam == 0) && (posts[0].EventType == TAPE_LOST));
+    CHECK((posts[1].EventParam == 2) && (posts[1].EventType == TAPE_LOST));
+    CHECK((posts[2].EventParam == 5) && (posts[2].EventType == TAPE_DETECTED));
+    CHECK((posts[3].EventParam == 7) && (posts[3].EventType == TAPE_DETECTED));
+}
+
+static void benchmark(void) {
+    ES_Hysteresis_t hyst;
+    int16_t values[BENCHMARK_STEPS][BENCHMARK_CHANNELS];
+    struct timespec start, end;
+    volatile uint32_t sink = 0;
+    double ns;
+    int pass, step, index;
+
+    for (step = 0; step < BENCHMARK_STEPS; step++) {
+        for (index = 0; index < BENCHMARK_CHANNELS; index++) {
+            // a triangle through both levels, each channel a step behind
+            int phase = (step + index) % BENCHMARK_STEPS;
+            int height = (phase < BENCHMARK_STEPS / 2) ? phase : BENCHMARK_STEPS - phase;
+            values[step][index] = 200 + height * 40;
+        }
+    }
+    ES_Hysteresis_Init(&hyst, bench_channels, BENCHMARK_CHANNELS, count_post, ES_HYST_UNKNOWN);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        sink += ES_Hysteresis_Update(&hyst, values[pass % BENCHMARK_STEPS]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("ES_Hysteresis_Update: %.0f channels/us on this host (%d channels)\n",
+            (double) BENCHMARK_PASSES * BENCHMARK_CHANNELS * 1000.0 / ns,
+            BENCHMARK_CHANNELS);
+}
+
+/*******************************************************************************
+ * MAIN                                                                        *
+ ******************************************************************************/
+
+int main(void) {
+    test_levels();
+    test_post();
+    test_post_order();
+    if (failures != 0) {
+        printf("hysteresis_test: %d failed\n", failures);
+        return 1;
+    }
+    printf("hysteresis_test: passed\n");
+    benchmark();
+    return 0;
+}
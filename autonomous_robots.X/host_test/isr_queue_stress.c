@@ -0,0 +1,126 @@
+/*
+ * File:   isr_queue_stress.c
+ *
+ * Host stress test for ES_ISRQueue.c, the host side twin of
+ * TEST_ISR_QUEUE_STRESS in main.c. One thread stands in for the interrupt
+ * handlers and puts numbered events into a ring, the other stands in for
+ * ES_Run and takes them out. The producer only moves on to the next number
+ * when a put succeeds, so the consumer must see every number exactly once, in
+ * order, and untorn (the low byte is also sent as the Service). Both sides
+ * stall now and then so the ring runs both empty and full. A side that finds
+ * the ring full or empty yields, so the test also finishes on one core, where
+ * the threads only meet at preemptions.
+ *
+ * ES_ISRQueueBarrier is a compiler barrier only, which is enough on the
+ * in-order PIC32 core and on x86 hosts (stores are not reordered with other
+ * stores, nor loads with other loads). On a weakly ordered host this test
+ * can fail without the ring being wrong for the robot.
+ *
+ * Build and run with "make -C host_test" from autonomous_robots.X, or
+ *   gcc -std=gnu99 -O2 -Wall -pthread -I. \
+ *       -Ihost_test/stubs host_test/isr_queue_stress.c ES_ISRQueue.c \
+ *       -o isr_queue_stress
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include "ES_Configure.h"
+#include "ES_ISRQueue.h"
+#include <BOARD.h>
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+#define STRESS_RING_SIZE 16
+#define STRESS_EVENTS 4000000UL
+#define STRESS_STALL_MASK 0x3FFF // stall after every 16384 events
+#define STRESS_STALL_SPINS 20000
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+static ES_ISRQueueEntry_t stress_entries[STRESS_RING_SIZE];
+static ES_ISRQueue_t stress_ring;
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+static void stall(void) {
+    volatile int spin;
+
+    for (spin = 0; spin < STRESS_STALL_SPINS; spin++)
+        ;
+}
+
+static void *producer(void *unused) {
+    ES_Event event;
+    unsigned long sent = 0;
+
+    event.EventType = ES_TIMEOUT;
+    while (sent < STRESS_EVENTS) {
+        event.EventParam = (uint16_t) sent;
+#ifdef USE_EVENT_PAYLOAD
+        event.EventPayload = (uint32_t) sent;
+#endif
+        if (ES_ISRQueue_Put(&stress_ring, (uint8_t) sent, event) == TRUE) {
+            sent++;
+            if ((sent & STRESS_STALL_MASK) == 0) {
+                stall(); // let the consumer run the ring empty
+            }
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+ * MAIN                                                                        *
+ ******************************************************************************/
+
+int main(void) {
+    pthread_t thread;
+    ES_Event event;
+    uint8_t service;
+    unsigned long received = 0;
+    unsigned long errors = 0;
+
+    ES_ISRQueue_Init(&stress_ring, stress_entries, STRESS_RING_SIZE);
+    if (pthread_create(&thread, NULL, producer, NULL) != 0) {
+        printf("isr_queue_stress: no producer thread\n");
+        return 1;
+    }
+    while (received < STRESS_EVENTS) {
+        if (ES_ISRQueue_Get(&stress_ring, &service, &event) == FALSE) {
+            sched_yield();
+            continue;
+        }
+        if ((event.EventType != ES_TIMEOUT) ||
+                (event.EventParam != (uint16_t) received) ||
+#ifdef USE_EVENT_PAYLOAD
+                (event.EventPayload != (uint32_t) received) ||
+#endif
+                (service != (uint8_t) received)) {
+            if (errors < 10) {
+                printf("event %lu arrived as %u/%u\n", received,
+                        event.EventParam, service);
+            }
+            errors++;
+        }
+        received++;
+        if ((received & STRESS_STALL_MASK) == 0) {
+            stall(); // let the producer run the ring full
+        }
+    }
+    pthread_join(thread, NULL);
+    printf("isr_queue_stress: %lu events, %lu errors, %u ring full\n",
+            received, errors, (unsigned) stress_ring.Overflows);
+    if ((errors != 0) || !ES_ISRQueue_IsEmpty(&stress_ring)) {
+        printf("isr_queue_stress: failed\n");
+        return 1;
+    }
+    printf("isr_queue_stress: passed\n");
+    return 0;
+}
@@ -0,0 +1,18 @@
+/*
+ * File:   GenericTypeDefs.h
+ *
+ * Host stand in for the Microchip header that BOARD.h includes, with only the
+ * parts the framework modules built by host_test/Makefile use.
+ */
+
+#ifndef GENERIC_TYPE_DEFS_H
+#define GENERIC_TYPE_DEFS_H
+
+#define FALSE 0
+#define TRUE 1
+
+typedef unsigned char BOOL;
+typedef unsigned char BYTE;
+typedef unsigned int UINT;
+
+#endif /* GENERIC_TYPE_DEFS_H */
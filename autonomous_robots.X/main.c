@@ -30,6 +30,11 @@
 //#define TEST_TRACKWIRE
 //#define TEST_SHOOTER
 //#define TEST_AD_BUG
+//#define TEST_ES_DISPATCH_BENCHMARK
+//#define TEST_ISR_QUEUE_STRESS
+//#define TEST_ES_QUEUE_BENCHMARK
+//#define TEST_TIMER_ISR_LOAD
+//#define TEST_HYSTERESIS_BENCHMARK
 
 
 #define TAPE_PIN_1 AD_PORTW3
@@ -118,11 +123,11 @@ int main() {
     motors_init(); //PWM_Init goes first
     AD_Init();
     init_tape_sensors(); // AD goes before this 
+    init_bumpers();
     RC_Init();
     ES_Timer_Init();
     trackwire_init();
     shooter_init();
-    beacon_init();
 
 
 
@@ -137,6 +142,7 @@ int main() {
     // now initialize the Events and Services Framework and start it running
     ErrorType = ES_Initialize();
     if (ErrorType == Success) {
+        beacon_init(); // its edges need the HR timers and ISR rings
         ErrorType = ES_Run();
 
     }
@@ -567,4 +573,504 @@ int main() {
 
 }
 
-#endif
\ No newline at end of file
+#endif
+
+#ifdef TEST_ES_DISPATCH_BENCHMARK
+//compares the cost of dispatching events with the old ES_Run sweep, which
+//went through services 0..N-1 running one event from each ready queue, and
+//with the clz pick of the highest priority ready service now in ES_Run. Both
+//dequeue from real ES queues and call the run functions through a table, as
+//ES_Run does, so only the way the next service is chosen differs. Each pass
+//queues BENCHMARK_DEPTH events for every service in the pattern and times
+//emptying them again.
+//The core timer counts at half the system clock, so cycles = 2 * ticks.
+#define BENCHMARK_PASSES 1000
+#define BENCHMARK_SERVICES 8
+#define BENCHMARK_DEPTH 2
+#define BENCHMARK_QUEUE_SIZE 4
+
+typedef ES_Event bench_run_t(ES_Event);
+
+static ES_Event bench_queues[BENCHMARK_SERVICES][BENCHMARK_QUEUE_SIZE + 1];
+static volatile uint32_t bench_runs;
+
+ES_Event bench_run(ES_Event event) {
+    bench_runs++;
+    event.EventType = ES_NO_EVENT;
+    return event;
+}
+
+static bench_run_t * const bench_run_funcs[BENCHMARK_SERVICES] = {
+    bench_run, bench_run, bench_run, bench_run,
+    bench_run, bench_run, bench_run, bench_run,
+};
+
+uint32_t bench_fill(uint32_t ready) {
+    ES_Event event = {ES_NO_EVENT, 0};
+    int service;
+    int depth;
+
+    for (service = 0; service < BENCHMARK_SERVICES; service++) {
+        if (ready & (1UL << service)) {
+            for (depth = 0; depth < BENCHMARK_DEPTH; depth++) {
+                ES_EnQueueFIFO(bench_queues[service], event);
+            }
+        }
+    }
+    return ready;
+}
+
+//ES_Run as it was: sweep every service, one event from each ready queue
+void old_dispatch(uint32_t ready) {
+    ES_Event event;
+    uint8_t service;
+    uint32_t mask;
+
+    while (ready != 0) {
+        for (service = 0; service < BENCHMARK_SERVICES; service++) {
+            mask = 1UL << service;
+            if (ready & mask) {
+                if (ES_DeQueue(bench_queues[service], &event) == 0) {
+                    ready &= ~mask;
+                }
+                bench_run_funcs[service](event);
+            }
+        }
+    }
+}
+
+//ES_Run now: always the highest priority ready service next
+void new_dispatch(uint32_t ready) {
+    ES_Event event;
+    uint8_t service;
+
+    while (ready != 0) {
+        service = ES_GetMSBitNum(ready);
+        if (ES_DeQueue(bench_queues[service], &event) == 0) {
+            ready &= ~(1UL << service);
+        }
+        bench_run_funcs[service](event);
+    }
+}
+
+int main() {
+    BOARD_Init();
+    const uint8_t ready_patterns[] = {0x01, 0x80, 0x81, 0xFF};
+    int pattern;
+    int pass;
+    int service;
+    uint32_t ready;
+    uint32_t events;
+    uint32_t start;
+    uint32_t sweep_ticks;
+    uint32_t clz_ticks;
+
+    for (service = 0; service < BENCHMARK_SERVICES; service++) {
+        ES_InitQueue(bench_queues[service], BENCHMARK_QUEUE_SIZE + 1);
+    }
+    printf("ES dispatch benchmark, %d passes per pattern, %d events per ready service\r\n",
+            BENCHMARK_PASSES, BENCHMARK_DEPTH);
+    for (pattern = 0; pattern < sizeof (ready_patterns); pattern++) {
+        sweep_ticks = 0;
+        clz_ticks = 0;
+        bench_runs = 0;
+        for (pass = 0; pass < BENCHMARK_PASSES; pass++) {
+            ready = bench_fill(ready_patterns[pattern]);
+            start = _CP0_GET_COUNT();
+            old_dispatch(ready);
+            sweep_ticks += _CP0_GET_COUNT() - start;
+
+            ready = bench_fill(ready_patterns[pattern]);
+            start = _CP0_GET_COUNT();
+            new_dispatch(ready);
+            clz_ticks += _CP0_GET_COUNT() - start;
+        }
+        //each dispatcher ran half of the events
+        events = bench_runs / 2;
+        printf("Ready=%02X sweep=%u cycles clz=%u cycles per event\r\n", ready_patterns[pattern],
+                (2 * sweep_ticks) / events, (2 * clz_ticks) / events);
+    }
+    for (;;)
+        ;
+}
+#endif
+
+#ifdef TEST_ISR_QUEUE_STRESS
+//hammers an ES_ISRQueue ring from the Timer4 interrupt while main() empties
+//it. Every event carries a sequence number in EventParam and its low byte in
+//Service; the producer only advances the sequence on a successful put, so the
+//consumer must see every number exactly once, in order, and untorn. main()
+//stalls now and then so the ring also runs full. Timer4 is the one timer
+//that nothing else in the project uses (Timer1 is the ES tick, Timer2 the
+//PWM, Timer3 the stepper and Timer5 the high resolution timers).
+//host_test/isr_queue_stress.c runs the same check with two threads.
+#define STRESS_RING_SIZE 16
+#define STRESS_PUT_RATE 20000 //puts per second
+#define STRESS_REPORT_EVENTS 200000
+#define STRESS_STALL_MASK 0x3FF //stall after every 1024 events
+#define STRESS_STALL_TICKS 4000 //100us of core timer ticks
+
+static ES_ISRQueueEntry_t stress_entries[STRESS_RING_SIZE];
+static ES_ISRQueue_t stress_ring;
+static uint16_t stress_next_seq = 0;
+
+void __ISR(_TIMER_4_VECTOR, ipl5auto) StressTimer4IntHandler(void) {
+    ES_Event event;
+
+    IFS0CLR = _IFS0_T4IF_MASK;
+    event.EventType = ES_TIMEOUT;
+    event.EventParam = stress_next_seq;
+    if (ES_ISRQueue_Put(&stress_ring, (uint8_t) stress_next_seq, event) == TRUE) {
+        stress_next_seq++;
+    }
+}
+
+int main() {
+    ES_Event event;
+    uint8_t service;
+    uint16_t expected = 0;
+    uint32_t received = 0;
+    uint32_t errors = 0;
+    uint32_t start;
+
+    BOARD_Init();
+    ES_ISRQueue_Init(&stress_ring, stress_entries, STRESS_RING_SIZE);
+
+    T4CON = 0;
+    TMR4 = 0;
+    PR4 = (BOARD_GetPBClock() / STRESS_PUT_RATE) - 1;
+    IPC4bits.T4IP = 5;
+    IFS0CLR = _IFS0_T4IF_MASK;
+    IEC0SET = _IEC0_T4IE_MASK;
+    T4CONSET = _T4CON_ON_MASK;
+
+    printf("ISR queue stress test, ring of %d at %d puts/s\r\n", STRESS_RING_SIZE, STRESS_PUT_RATE);
+    while (1) {
+        if (ES_ISRQueue_Get(&stress_ring, &service, &event) == TRUE) {
+            if ((event.EventParam != expected) || (service != (uint8_t) event.EventParam)) {
+                errors++;
+                expected = event.EventParam;
+            }
+            expected++;
+            received++;
+            if ((received & STRESS_STALL_MASK) == 0) {
+                start = _CP0_GET_COUNT();
+                while ((_CP0_GET_COUNT() - start) < STRESS_STALL_TICKS)
+                    ;
+            }
+            if ((received % STRESS_REPORT_EVENTS) == 0) {
+                printf("%u events, %u errors, %u ring full\r\n", received, errors,
+                        stress_ring.Overflows);
+            }
+        }
+    }
+}
+#endif
+
+#ifdef TEST_ES_QUEUE_BENCHMARK
+//measures posts per microsecond into an 8 entry ES queue, with the old
+//% QueueSize index and with the mask. Each pass posts one event and pulls it
+//back out so the queue never fills.
+//The core timer counts ES_TIMESTAMP_TICKS_PER_US ticks per microsecond.
+#define BENCHMARK_PASSES 10000
+
+typedef struct {
+    unsigned char QueueSize;
+    unsigned char CurrentIndex;
+    unsigned char NumEntries;
+} old_queue_t;
+
+//ES_EnQueueFIFO as it was, with the modulo on every post
+uint8_t old_enqueue(ES_Event *pBlock, ES_Event event) {
+    old_queue_t *pQueue = (old_queue_t *) pBlock;
+    if (pQueue->NumEntries < pQueue->QueueSize) {
+        pBlock[1 + ((pQueue->CurrentIndex + pQueue->NumEntries) % pQueue->QueueSize)] = event;
+        pQueue->NumEntries++;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+void old_dequeue(ES_Event *pBlock, ES_Event *pEvent) {
+    old_queue_t *pQueue = (old_queue_t *) pBlock;
+    *pEvent = pBlock[1 + pQueue->CurrentIndex];
+    pQueue->CurrentIndex++;
+    if (pQueue->CurrentIndex >= pQueue->QueueSize)
+        pQueue->CurrentIndex = pQueue->CurrentIndex % pQueue->QueueSize;
+    pQueue->NumEntries--;
+}
+
+void print_rate(const char *name, uint32_t ticks) {
+    //posts per us, printed with 3 decimals
+    uint32_t milli_posts_per_us = ((uint64_t) BENCHMARK_PASSES * 1000 * ES_TIMESTAMP_TICKS_PER_US) / ticks;
+    printf("%s: %u ticks, %u.%03u posts/us\r\n", name, ticks,
+            milli_posts_per_us / 1000, milli_posts_per_us % 1000);
+}
+
+int main() {
+    static ES_Event queue8[8 + 1];
+    old_queue_t *pOld = (old_queue_t *) queue8;
+    ES_Event event = {ES_TIMEOUT, 0};
+    ES_Event out;
+    uint32_t start;
+    int pass;
+
+    BOARD_Init();
+    printf("ES queue benchmark, %d post/pull pairs\r\n", BENCHMARK_PASSES);
+
+    pOld->QueueSize = 8;
+    pOld->CurrentIndex = 0;
+    pOld->NumEntries = 0;
+    start = _CP0_GET_COUNT();
+    for (pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        old_enqueue(queue8, event);
+        old_dequeue(queue8, &out);
+    }
+    print_rate("old, 8 entries, %", _CP0_GET_COUNT() - start);
+
+    ES_InitQueue(queue8, ARRAY_SIZE(queue8));
+    start = _CP0_GET_COUNT();
+    for (pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        ES_EnQueueFIFO(queue8, event);
+        ES_DeQueue(queue8, &out);
+    }
+    print_rate("new, 8 entries, mask", _CP0_GET_COUNT() - start);
+    for (;;)
+        ;
+}
+#endif
+
+#ifdef TEST_TIMER_ISR_LOAD
+//keeps every ES timer that has a service running, at staggered times, fills
+//the TIMER_POOL timers with periodic ones and prints how long the Timer1 tick
+//ISR takes, so the delta list timers can be checked under full load. Needs
+//USE_SERVICE_STATS. ES_Run is not called, so
+//the timeouts pile up in the IPL 3 ISR ring and later ones are dropped there;
+//that only leaves out the copy of the event into the ring.
+//As the baseline, the same timers are also kept in a copy of the old tick,
+//which counted down every active slot, and that is run and timed once per
+//millisecond from main() with interrupts off. Its expiries go to a stub that
+//only counts them, so the old figure is a little low if anything.
+#define LOAD_REPORT_PERIOD 2000
+#define LOAD_TIMER_COUNT 15 //timers 0..14, the ones without a service fail to start
+#define LOAD_POOLED_COUNT 16 //timers 16..31 are TIMER_POOL
+#define LOAD_OLD_SLOTS 32
+
+static uint32_t old_timer_array[LOAD_OLD_SLOTS];
+static uint32_t old_periods[LOAD_OLD_SLOTS];
+static uint32_t old_active_flags;
+static uint32_t old_posted;
+static uint32_t old_ticks_max;
+static uint64_t old_ticks_total;
+static uint32_t old_ticks_count;
+
+uint8_t old_post(ES_Event event) {
+    old_posted++;
+    return TRUE;
+}
+
+//Timer1IntHandler as it was, less the interrupt flag and FreeRunningTimer
+void old_tick(void) {
+    static ES_Event event;
+    uint8_t timer;
+
+    if (old_active_flags != 0) {
+        for (timer = 0; timer < LOAD_OLD_SLOTS; timer++) {
+            if ((old_active_flags & (1UL << timer)) != 0) {
+                if (--old_timer_array[timer] == 0) {
+                    event.EventType = ES_TIMEOUT;
+                    event.EventParam = timer;
+                    old_post(event);
+                    old_active_flags &= ~(1UL << timer);
+                }
+            }
+        }
+    }
+}
+
+void old_start(uint8_t timer, uint32_t period) {
+    old_periods[timer] = period;
+    old_timer_array[timer] = period;
+    old_active_flags |= 1UL << timer;
+}
+
+int main() {
+    uint32_t last_report;
+    uint32_t last_tick;
+    uint32_t mean_us;
+    uint32_t max_us;
+    uint32_t start;
+    uint32_t ticks;
+    unsigned int saved_status;
+    int timers_running = 0;
+    int timer;
+
+    BOARD_Init();
+    AD_Init();
+    if (ES_Initialize() != Success) {
+        printf("ES_Initialize failed\r\n");
+        for (;;)
+            ;
+    }
+    for (timer = 0; timer < LOAD_TIMER_COUNT; timer++) {
+        if (ES_Timer_InitTimer(timer, 1 + timer) == ES_Timer_OK) {
+            old_start(timer, 1 + timer);
+            timers_running++;
+        }
+    }
+    for (timer = 0; timer < LOAD_POOLED_COUNT; timer++) {
+        if (ES_Timer_StartPooled(PostTopHSM, 0, 1 + timer, 1 + timer) != ES_TIMER_NO_HANDLE) {
+            old_start(LOAD_OLD_SLOTS - LOAD_POOLED_COUNT + timer, 1 + timer);
+            timers_running++;
+        }
+    }
+    last_report = ES_Timer_GetTime();
+    last_tick = last_report;
+    ES_Timer_ClearISRTime();
+    while (1) {
+        //re-arm every timer that has run out, StartTimer fails once it has
+        for (timer = 0; timer < LOAD_TIMER_COUNT; timer++) {
+            if (ES_Timer_StartTimer(timer) == ES_Timer_ERR) {
+                ES_Timer_InitTimer(timer, 1 + timer);
+            }
+        }
+        if (ES_Timer_GetTime() != last_tick) {
+            last_tick = ES_Timer_GetTime();
+            saved_status = __builtin_disable_interrupts();
+            start = _CP0_GET_COUNT();
+            old_tick();
+            ticks = _CP0_GET_COUNT() - start;
+            __builtin_mtc0(_CP0_STATUS, _CP0_STATUS_SELECT, saved_status);
+            old_ticks_total += ticks;
+            old_ticks_count++;
+            if (ticks > old_ticks_max) {
+                old_ticks_max = ticks;
+            }
+            //the old timers were re-armed from the main loop too
+            for (timer = 0; timer < LOAD_OLD_SLOTS; timer++) {
+                if ((old_periods[timer] != 0) && !(old_active_flags & (1UL << timer))) {
+                    old_start(timer, old_periods[timer]);
+                }
+            }
+        }
+        if ((ES_Timer_GetTime() - last_report) >= LOAD_REPORT_PERIOD) {
+            last_report = ES_Timer_GetTime();
+            ES_Timer_GetISRTime(&mean_us, &max_us);
+            printf("tick isr with %d timers: mean %u us, max %u us\r\n",
+                    timers_running, mean_us, max_us);
+            printf("old scan, same timers: mean %u us, max %u us\r\n",
+                    old_ticks_count ? (uint32_t) ((old_ticks_total / old_ticks_count) / ES_TIMESTAMP_TICKS_PER_US) : 0,
+                    old_ticks_max / ES_TIMESTAMP_TICKS_PER_US);
+            ES_Timer_ClearISRTime();
+            old_ticks_total = 0;
+            old_ticks_count = 0;
+            old_ticks_max = 0;
+        }
+    }
+}
+#endif
+
+#ifdef TEST_HYSTERESIS_BENCHMARK
+//measures analog channels evaluated per microsecond: the hand written
+//threshold check the tape sensors had, the hysteresis engine on its own and
+//the engine posting its events. The readings sweep each channel through both
+//levels so the states keep changing; the posts go to a stub that counts them.
+//The core timer counts ES_TIMESTAMP_TICKS_PER_US ticks per microsecond.
+#define BENCHMARK_PASSES 10000
+#define BENCHMARK_CHANNELS 8
+#define BENCHMARK_STEPS 16
+#define BENCH_LOW 300
+#define BENCH_HIGH 400
+
+static uint32_t posted;
+
+uint8_t count_post(ES_Event event) {
+    posted++;
+    return TRUE;
+}
+
+#define BENCH_CHANNEL(index) {BENCH_LOW, BENCH_HIGH, 1, TAPE_DETECTED, TAPE_LOST, index}
+
+static const ES_HystChannel_t bench_channels[BENCHMARK_CHANNELS] = {
+    BENCH_CHANNEL(0), BENCH_CHANNEL(1), BENCH_CHANNEL(2), BENCH_CHANNEL(3),
+    BENCH_CHANNEL(4), BENCH_CHANNEL(5), BENCH_CHANNEL(6), BENCH_CHANNEL(7),
+};
+
+//detect_tape_event as it was, one if/else per channel
+uint32_t old_update(tape_sensor_status *status, const int16_t *values) {
+    uint32_t changed = 0;
+    int index;
+
+    for (index = 0; index < BENCHMARK_CHANNELS; index++) {
+        if (values[index] < BENCH_LOW) {
+            if (status[index] != on_tape) {
+                status[index] = on_tape;
+                changed |= 1UL << index;
+            }
+        } else if (values[index] > BENCH_HIGH) {
+            if (status[index] != off_tape) {
+                status[index] = off_tape;
+                changed |= 1UL << index;
+            }
+        }
+    }
+    return changed;
+}
+
+void print_rate(const char *name, uint32_t ticks) {
+    //channels per us, printed with 3 decimals
+    uint32_t milli_per_us = ((uint64_t) BENCHMARK_PASSES * BENCHMARK_CHANNELS * 1000 * ES_TIMESTAMP_TICKS_PER_US) / ticks;
+    printf("%s: %u ticks, %u.%03u channels/us\r\n", name, ticks,
+            milli_per_us / 1000, milli_per_us % 1000);
+}
+
+int main() {
+    static int16_t values[BENCHMARK_STEPS][BENCHMARK_CHANNELS];
+    static ES_Hysteresis_t hyst;
+    tape_sensor_status status[BENCHMARK_CHANNELS];
+    volatile uint32_t changed = 0;
+    uint32_t start;
+    int pass;
+    int step;
+    int channel;
+
+    BOARD_Init();
+    printf("hysteresis benchmark, %d passes of %d channels\r\n", BENCHMARK_PASSES, BENCHMARK_CHANNELS);
+
+    //a triangle from 200 to 500 and back, each channel a step on from the last
+    for (step = 0; step < BENCHMARK_STEPS; step++) {
+        for (channel = 0; channel < BENCHMARK_CHANNELS; channel++) {
+            int phase = (step + channel) % BENCHMARK_STEPS;
+            int rise = (phase < BENCHMARK_STEPS / 2) ? phase : BENCHMARK_STEPS - phase;
+            values[step][channel] = 200 + rise * (300 / (BENCHMARK_STEPS / 2));
+        }
+    }
+
+    for (channel = 0; channel < BENCHMARK_CHANNELS; channel++) {
+        status[channel] = unknown;
+    }
+    start = _CP0_GET_COUNT();
+    for (pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        changed |= old_update(status, values[pass % BENCHMARK_STEPS]);
+    }
+    print_rate("old, if/else per channel", _CP0_GET_COUNT() - start);
+
+    ES_Hysteresis_Init(&hyst, bench_channels, BENCHMARK_CHANNELS, count_post, ES_HYST_UNKNOWN);
+    start = _CP0_GET_COUNT();
+    for (pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        changed |= ES_Hysteresis_Update(&hyst, values[pass % BENCHMARK_STEPS]);
+    }
+    print_rate("engine, update only", _CP0_GET_COUNT() - start);
+
+    ES_Hysteresis_Init(&hyst, bench_channels, BENCHMARK_CHANNELS, count_post, ES_HYST_UNKNOWN);
+    posted = 0;
+    start = _CP0_GET_COUNT();
+    for (pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        ES_Hysteresis_Run(&hyst, values[pass % BENCHMARK_STEPS], 0);
+    }
+    print_rate("engine, update and post", _CP0_GET_COUNT() - start);
+    printf("%u events posted\r\n", posted);
+    for (;;)
+        ;
+}
+#endif
@@ -3,6 +3,7 @@
 #include "IO_Ports.h"
 #include "AD.h"
 #include "pwm.h"
+#include "ES_Log.h"
 #include "stdio.h"
 
 #define DRIVING_MOTOR_PORT  PORTY
@@ -155,7 +156,7 @@ void adjust_pwm() {
     if (PWM_Tank_Turns > 1000) {
         PWM_Tank_Turns = 1000;
     }
-    printf("PWM_ALL-------------------> %d\r\n", PWM_ALL);
+    ES_LOG1(LOG_PWM_ALL, PWM_ALL);
     Motor_Speed_B = PWM_ALL - MOTOR_OFFSET;
     Motor_Speed_A = Motor_Speed_B;
 
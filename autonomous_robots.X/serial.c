@@ -205,6 +205,17 @@ char IsTransmitEmpty(void)
     return FALSE;
 }
 
+/**
+ * @Function SERIAL_GetTxFree(void)
+ * @param None.
+ * @return the number of characters that can still go into the transmit
+ *         buffer before PutChar starts dropping them
+ * @brief  one slot of the circular buffer is always left empty */
+unsigned int SERIAL_GetTxFree(void)
+{
+    return (transmitBuffer->size - 1) - getLength(transmitBuffer);
+}
+
 /****************************************************************************
  Function
     IntUart1Handler
@@ -52,6 +52,14 @@ char GetChar(void);
  * @author Max Dunne, 2011.12.15 */
 char IsTransmitEmpty(void);
 
+/**
+ * @Function SERIAL_GetTxFree(void)
+ * @param None.
+ * @return the number of characters that can still go into the transmit
+ *         buffer before PutChar starts dropping them
+ * @brief  lets a caller that prints in bursts stop before the buffer fills */
+unsigned int SERIAL_GetTxFree(void);
+
 /**
  * @Function IsReceiveEmpty(void)
  * @param None.
@@ -35,6 +35,8 @@
 //#include "LED.h"
 #include "tape_detector_fsm_service.h"
 #include "TopHSM.h"
+#include "bumper_service.h"
+#include "event_checker.h"
 #include <AD.h>
 //Uncomment these for the Roaches
 //#include "roach.h"
@@ -50,7 +52,32 @@
 #define TAPE_LOW_THRESHOLD 300
 
 
-#define TWO_MILLISECOND 5
+// One periodic timer paces the whole cycle. The LED is switched on a tick,
+// the next tick moves on to the reading state and the READING_COUNT ticks
+// after that each take an A/D sample, so the sensors settle for two ticks
+// before the first one. The A/D library converts about 9300 times a second
+// shared over every pin in use, so with the 5 tape, 2 trackwire and battery
+// pins each pin is refreshed every 0.86 ms; the tick is one such scan so no
+// reading is taken twice. With the high resolution timers a whole on/off
+// cycle takes 12 * 900 us = 10.8 ms instead of 60 ms of ES ticks. With the
+// periodic tasks TapeSensorTask steps the machine at the same rate with no
+// timer at all.
+#if defined(USE_PERIODIC_TASKS)
+#define TAPE_SAMPLE_US (TAPE_TASK_PERIOD * ES_TASK_TICK_US)
+#define StartTapeTimer(time)
+#define TAPE_TIMEOUT ES_TIMEOUT
+#elif defined(USE_HR_TIMERS)
+#define TAPE_SAMPLE_TIME 90 // 10 us ticks
+#define TAPE_SAMPLE_US (TAPE_SAMPLE_TIME * ES_HR_TICK_US)
+#define StartTapeTimer(time) ES_HRTimer_InitPeriodicTimer(TAPE_SENSOR_HR_TIMER, time)
+#define TAPE_TIMEOUT ES_HR_TIMEOUT
+#else
+#define TAPE_SAMPLE_TIME 5 // ms
+#define TAPE_SAMPLE_US (TAPE_SAMPLE_TIME * 1000)
+#define StartTapeTimer(time) ES_Timer_InitPeriodicTimer(TAPE_SENSOR_TIMER, time)
+#define TAPE_TIMEOUT ES_TIMEOUT
+#endif
+#define TAPE_PERIOD_BIN_US (TAPE_SAMPLE_US / 32)
 
 
 
@@ -128,8 +155,23 @@ int tape_sensor_average(int* arr, int size) {
 
 tape_sensor tape_sensors[TAPE_SENSOR_COUNT];
 
+// on tape below TAPE_LOW_THRESHOLD, off tape above TAPE_HIGH_THRESHOLD. The
+// readings are already averaged over READING_COUNT samples, so no debounce.
+#define TAPE_CHANNEL(index) \
+    {TAPE_LOW_THRESHOLD, TAPE_HIGH_THRESHOLD, 1, TAPE_DETECTED, TAPE_LOST, index}
+
+static const ES_HystChannel_t TapeChannels[TAPE_SENSOR_COUNT] = {
+    TAPE_CHANNEL(0), TAPE_CHANNEL(1), TAPE_CHANNEL(2), TAPE_CHANNEL(3), TAPE_CHANNEL(4),
+};
+static ES_Hysteresis_t TapeHysteresis;
+
 static TapeDetectorFSMState_t CurrentState = InitPState; // <- change enum name to match ENUM
+#ifndef USE_PERIODIC_TASKS
 static uint8_t MyPriority;
+#endif
+#ifdef USE_PERIOD_HISTOGRAMS
+static ES_Histogram_t TapePeriod;
+#endif
 
 
 
@@ -147,6 +189,7 @@ static uint8_t MyPriority;
  *        to rename this to something appropriate.
  *        Returns TRUE if successful, FALSE otherwise
  * @author J. Edward Carryer, 2011.10.23 19:25 */
+#ifndef USE_PERIODIC_TASKS
 uint8_t InitTapeDetectorFSMService(uint8_t Priority) {
     MyPriority = Priority;
     // put us into the Initial PseudoState
@@ -172,6 +215,7 @@ uint8_t InitTapeDetectorFSMService(uint8_t Priority) {
 uint8_t PostTapeDetectorFSMService(ES_Event ThisEvent) {
     return ES_PostToService(MyPriority, ThisEvent);
 }
+#endif
 
 /**
  * @Function RunTemplateFSM(ES_Event ThisEvent)
@@ -190,6 +234,11 @@ ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent) {
     TapeDetectorFSMState_t nextState; // <- need to change enum type here
 
     // ES_Tattle(); // trace call stack
+#ifdef USE_PERIOD_HISTOGRAMS
+    if (ThisEvent.EventType == TAPE_TIMEOUT) {
+        ES_Histogram_Mark(&TapePeriod);
+    }
+#endif
 
     switch (CurrentState) {
 
@@ -215,6 +264,10 @@ ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent) {
                 // this is where you would put any actions associated with the
                 // transition from the initial pseudo-state into the actual
                 // initial state
+                StartTapeTimer(TAPE_SAMPLE_TIME);
+#ifdef USE_PERIOD_HISTOGRAMS
+                ES_Histogram_Init(&TapePeriod, "tape", TAPE_SAMPLE_US, TAPE_PERIOD_BIN_US);
+#endif
 
                 // now put the machine into the actual initial state
                 nextState = On;
@@ -234,11 +287,9 @@ ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent) {
                     //  printf("enter on_entry\r\n");
                     IO_PortsSetPortBits(TAPE_PORT, LED_PIN); //turn on the LED on the IR sensor
 
-                    int rc = ES_Timer_InitTimer(TAPE_SENSOR_TIMER, TWO_MILLISECOND);
-
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
-                case ES_TIMEOUT:
+                case TAPE_TIMEOUT:
                     // this is where you would put any actions associated with the
                     // transition from the initial pseudo-state into the actual
                     // initial state
@@ -267,16 +318,13 @@ ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent) {
                 case ES_ENTRY:
 
                     on_reading_counter = 0;
-                    ES_Timer_InitTimer(TAPE_SENSOR_TIMER, TWO_MILLISECOND);
 
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
-                case ES_TIMEOUT:
-                    if (on_reading_counter < READING_COUNT) {
-                        read_tape_sensors(OnReading, on_reading_counter);
-                        on_reading_counter++;
-                        ES_Timer_InitTimer(TAPE_SENSOR_TIMER, TWO_MILLISECOND);
-                    } else {
+                case TAPE_TIMEOUT:
+                    read_tape_sensors(OnReading, on_reading_counter);
+                    on_reading_counter++;
+                    if (on_reading_counter >= READING_COUNT) {
                         nextState = Off;
                         makeTransition = TRUE;
                         ThisEvent.EventType = ES_NO_EVENT;
@@ -306,11 +354,10 @@ ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent) {
                 case ES_ENTRY:
                     // printf("Off_enter on_entry\r\n");
                     IO_PortsClearPortBits(TAPE_PORT, LED_PIN); //turn on the LED on the IR sensor
-                    int rc = ES_Timer_InitTimer(TAPE_SENSOR_TIMER, TWO_MILLISECOND);
 
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
-                case ES_TIMEOUT:
+                case TAPE_TIMEOUT:
                     // this is where you would put any actions associated with the
                     // transition from the initial pseudo-state into the actual
                     // initial state
@@ -334,8 +381,6 @@ ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent) {
 
                 case ES_ENTRY:
 
-
-                    ES_Timer_InitTimer(TAPE_SENSOR_TIMER, TWO_MILLISECOND);
                     ThisEvent.EventType = ES_NO_EVENT;
 
                     off_reading_counter = 0;
@@ -344,17 +389,15 @@ ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent) {
 
 
                     break;
-                case ES_TIMEOUT:
+                case TAPE_TIMEOUT:
                     // this is where you would put any actions associated with the
                     // transition from the initial pseudo-state into the actual
                     // initial state
 
                     // now put the machine into the actual initial state
-                    if (off_reading_counter < READING_COUNT) {
-                        read_tape_sensors(OffReading, off_reading_counter);
-                        off_reading_counter++;
-                        ES_Timer_InitTimer(TAPE_SENSOR_TIMER, TWO_MILLISECOND);
-                    } else {
+                    read_tape_sensors(OffReading, off_reading_counter);
+                    off_reading_counter++;
+                    if (off_reading_counter >= READING_COUNT) {
                         nextState = On;
                         makeTransition = TRUE;
                         ThisEvent.EventType = ES_NO_EVENT;
@@ -388,6 +431,21 @@ ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent) {
     return ThisEvent;
 }
 
+/**
+ * @Function TapeSensorTask(void)
+ * @param None.
+ * @return FALSE
+ * @brief  runs one TAPE_TIMEOUT through the state machine, in place of the
+ *         timer event that paces it without the periodic tasks */
+uint8_t TapeSensorTask(void) {
+    ES_Event Tick;
+
+    Tick.EventType = TAPE_TIMEOUT;
+    Tick.EventParam = 0;
+    RunTapeDetectorFSMService(Tick);
+    return FALSE;
+}
+
 int is_on_T() {
     if ((get_front_tape_status() == on_tape) &&
             (get_center_tape_status() == on_tape) &&
@@ -466,7 +524,7 @@ void init_tape_sensors() {
     //printf("Initializing Tape pins\r\n");
     //printf("Active Pins=%x\r\n", AD_ActivePins());
     for (index = 0; index < TAPE_SENSOR_COUNT; index++) {
-        printf("Pin:%d done\r\n", index);
+        ES_LOG1(LOG_TAPE_PIN, index);
         tape_sensors[index].direction = index;
         tape_sensors[index].pin = tape_sensor_pins[index];
         tape_sensors[index].status = unknown;
@@ -486,7 +544,13 @@ void init_tape_sensors() {
         //printf("rc=%d\r\n",rc);
 
     }
-
+    ES_Hysteresis_Init(&TapeHysteresis, TapeChannels, TAPE_SENSOR_COUNT, ES_Publish, ES_HYST_UNKNOWN);
+#ifdef USE_PERIODIC_TASKS
+    // not a service, so take the initial transition here, before
+    // ES_Initialize starts the task that runs the machine from then on
+    CurrentState = InitPState;
+    RunTapeDetectorFSMService(INIT_EVENT);
+#endif
 }
 
 int get_front_tape_status() {
@@ -509,73 +573,56 @@ int get_back_tape_status() {
     return tape_sensors[BACK_TAPE_SENSOR].status;
 }
 
+int get_tape_status(int sensor) {
+    return tape_sensors[sensor].status;
+}
+
+/**
+ * @Function get_sensor_snapshot(void)
+ * @param None.
+ * @return the tape, bumper and trackwire state packed into 32 bits
+ * @brief  See the SNAPSHOT_ defines in tape_detector_fsm_service.h for the
+ *         layout. Attached to the tape events so the state machines see every
+ *         sensor as it was when the event happened, without calling back into
+ *         the getters. */
+uint32_t get_sensor_snapshot(void) {
+    uint32_t snapshot = 0;
+    int index;
+
+    for (index = 0; index < TAPE_SENSOR_COUNT; index++) {
+        snapshot |= ((uint32_t) tape_sensors[index].status & SNAPSHOT_TAPE_MASK) <<
+                (SNAPSHOT_TAPE_SHIFT + SNAPSHOT_TAPE_BITS * index);
+    }
+    snapshot |= ((uint32_t) (get_bumper_bank() >> SNAPSHOT_BUMPER_PIN_SHIFT) &
+            SNAPSHOT_BUMPER_MASK) << SNAPSHOT_BUMPER_SHIFT;
+    snapshot |= (uint32_t) get_trackwire_diff() << SNAPSHOT_TRACKWIRE_SHIFT;
+    return snapshot;
+}
+
 void detect_tape_event() {
-    int index = 0;
+    int16_t diffs[TAPE_SENSOR_COUNT];
+    uint32_t changed;
+    uint32_t snapshot = 0;
+    int index;
 
     for (index = 0; index < TAPE_SENSOR_COUNT; index++) {
         tape_sensors[index].low_val_average = tape_sensor_average(tape_sensors[index].low_vals, READING_COUNT);
         tape_sensors[index].high_val_average = tape_sensor_average(tape_sensors[index].high_vals, READING_COUNT);
-        int diff = tape_sensors[index].low_val_average - tape_sensors[index].high_val_average;
-        //        if (index == 3) {
-        //            printf("low Val=%x, high val=%x,diff= %d \r\n", tape_sensors[index].low_val_average, tape_sensors[index].high_val_average, diff);
-        //        }
-
-        //printf("index= %d, low Val = %d, high val= %d ,diff= %d | ", index, tape_sensors[index].low_val_average, tape_sensors[index].high_val_average, diff);
-
-
-        if (diff < TAPE_LOW_THRESHOLD) {
-            if (tape_sensors[index].status != on_tape) {
-                tape_sensors[index].status = on_tape;
-
-                if (index < 4) {
-                    //   int current = LED_GetBank(LED_BANK1);
-
-                    // LED_SetBank(LED_BANK1, current | (1 << index ));
-
-                } else {
-                    //  int current = LED_GetBank(LED_BANK2);
-
-
-                    //  LED_SetBank(LED_BANK2, current | (1 << (index - 4)));
-
-                }
-                ES_Event newEvent;
-                newEvent.EventType = TAPE_DETECTED;
-                newEvent.EventParam = index;
-                PostTopHSM(newEvent);
-
-//                if (is_on_T() == TRUE) {
-//
-//                    newEvent.EventType = T_FOUND;
-//                    newEvent.EventParam = index;
-//                    PostTopHSM(newEvent);
-//                }
-            }
-        } else if (diff > TAPE_HIGH_THRESHOLD) {
-
-            if (tape_sensors[index].status != off_tape) {
-                tape_sensors[index].status = off_tape;
-                if (index < 4) {
-                    //int current = LED_GetBank(LED_BANK1);
-
-                    // LED_OffBank(LED_BANK1, current | (1 << index ));
-                } else {
-                    // int current = LED_GetBank(LED_BANK2);
-
-
-                    //  LED_OffBank(LED_BANK2, current | (1 << (index - 4)));
-                }
-                ES_Event newEvent;
-                newEvent.EventType = TAPE_LOST;
-                newEvent.EventParam = index;
-                PostTopHSM(newEvent);
-            }
+        diffs[index] = tape_sensors[index].low_val_average - tape_sensors[index].high_val_average;
+    }
+    changed = ES_Hysteresis_Update(&TapeHysteresis, diffs);
+    if (changed == 0) {
+        return;
+    }
+    for (index = 0; index < TAPE_SENSOR_COUNT; index++) {
+        if (changed & (1UL << index)) {
+            tape_sensors[index].status =
+                    (ES_Hysteresis_GetState(&TapeHysteresis, index) == ES_HYST_IN) ? on_tape : off_tape;
         }
-
-
-    }// for loop
-    // printf("\r\n");
-
-
-
+    }
+    // every event of this pass carries the sensors with all of its changes
+#ifdef USE_EVENT_PAYLOAD
+    snapshot = get_sensor_snapshot();
+#endif
+    ES_Hysteresis_Post(&TapeHysteresis, changed, snapshot);
 }
\ No newline at end of file
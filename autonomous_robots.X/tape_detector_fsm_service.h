@@ -68,6 +68,36 @@ typedef enum {
     unknown,
 } tape_sensor_status;
 
+// Layout of the sensor snapshot from get_sensor_snapshot(), carried in the
+// EventPayload of TAPE_DETECTED/TAPE_LOST when USE_EVENT_PAYLOAD is defined:
+//   bits 0-9   the tape_sensor_status of each tape sensor, two bits each
+//              by index, so a sensor that has not settled reads as unknown
+//   bits 10-18 the bumper bank (PIN3..PIN11) shifted down by 3
+//   bits 19-31 front minus back trackwire reading, signed (the A/D
+//              readings are 10 bits, so the difference always fits)
+#define SNAPSHOT_TAPE_SHIFT 0
+#define SNAPSHOT_TAPE_BITS 2
+#define SNAPSHOT_TAPE_MASK 0x3
+#define SNAPSHOT_BUMPER_SHIFT 10
+#define SNAPSHOT_BUMPER_PIN_SHIFT 3
+#define SNAPSHOT_BUMPER_MASK 0x1FF
+#define SNAPSHOT_TRACKWIRE_SHIFT 19
+
+#define SNAPSHOT_TAPE_STATUS(snapshot, sensor) \
+    ((tape_sensor_status) (((snapshot) >> (SNAPSHOT_TAPE_SHIFT + SNAPSHOT_TAPE_BITS * (sensor))) & \
+    SNAPSHOT_TAPE_MASK))
+#define SNAPSHOT_BUMPERS(snapshot) \
+    ((((snapshot) >> SNAPSHOT_BUMPER_SHIFT) & SNAPSHOT_BUMPER_MASK) << SNAPSHOT_BUMPER_PIN_SHIFT)
+#define SNAPSHOT_TRACKWIRE_DIFF(snapshot) ((int16_t) ((int32_t) (snapshot) >> SNAPSHOT_TRACKWIRE_SHIFT))
+
+// status of a tape sensor when a tape event was posted, taken from the
+// event's snapshot if it has one, unknown included.
+#ifdef USE_EVENT_PAYLOAD
+#define TAPE_EVENT_STATUS(event, sensor) SNAPSHOT_TAPE_STATUS((event).EventPayload, sensor)
+#else
+#define TAPE_EVENT_STATUS(event, sensor) get_tape_status(sensor)
+#endif
+
 
 
 
@@ -83,6 +113,8 @@ int get_right_tape_status();
 int get_left_tape_status();
 int get_center_tape_status();
 int get_back_tape_status();
+int get_tape_status(int sensor);
+uint32_t get_sensor_snapshot(void);
 void init_tape_sensors();
 /**
  * @Function InitTemplateFSM(uint8_t Priority)
@@ -94,6 +126,7 @@ void init_tape_sensors();
  *        to rename this to something appropriate.
  *        Returns TRUE if successful, FALSE otherwise
  * @author J. Edward Carryer, 2011.10.23 19:25 */
+#ifndef USE_PERIODIC_TASKS
 uint8_t InitTapeDetectorFSMService(uint8_t Priority);
 
 /**
@@ -106,6 +139,7 @@ uint8_t InitTapeDetectorFSMService(uint8_t Priority);
  *        Returns TRUE if successful, FALSE otherwise
  * @author J. Edward Carryer, 2011.10.23 19:25 */
 uint8_t PostTapeDetectorFSMService(ES_Event ThisEvent);
+#endif
 
 
 /**
@@ -122,5 +156,16 @@ uint8_t PostTapeDetectorFSMService(ES_Event ThisEvent);
  * @author J. Edward Carryer, 2011.10.23 19:25 */
 ES_Event RunTapeDetectorFSMService(ES_Event ThisEvent);
 
+/**
+ * @Function TapeSensorTask(void)
+ * @param None.
+ * @return FALSE, the tape events are posted from inside the state machine
+ * @brief  Steps the LED on/off sampling cycle by one tick. With
+ *         USE_PERIODIC_TASKS it is run from the task table every
+ *         TAPE_TASK_PERIOD task ticks and is the only thing that runs the
+ *         tape state machine after its initial transition, which
+ *         init_tape_sensors takes. */
+uint8_t TapeSensorTask(void);
+
 #endif /* TAPE_DETECTOR_FSM_SERVICE_H */
 
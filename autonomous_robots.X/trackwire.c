@@ -0,0 +1,100 @@
+/*
+ * File:   trackwire.c
+ *
+ * Low pass filter, normalised error and peak tracking for the two trackwire
+ * coils. The filters keep TRACKWIRE_FILTER_SHIFT extra bits so the small
+ * steps of a slow change are not lost. Everything the state machines read is
+ * worked out in trackwire_update and kept as a single 16 bit value, so a
+ * reading taken between two updates is never half old and half new.
+ */
+
+/*******************************************************************************
+ * MODULE #INCLUDE                                                             *
+ ******************************************************************************/
+
+#include "BOARD.h"
+#include "trackwire.h"
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+// each sample moves the filter 1 / 2^this of the way, about 4 samples or
+// 3.6 ms at the trackwire task period
+#define TRACKWIRE_FILTER_SHIFT 2
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+static uint32_t FrontFilter;
+static uint32_t BackFilter;
+static uint8_t Started = FALSE;
+
+static uint16_t Front;
+static uint16_t Back;
+static uint16_t Strength;
+static int16_t Error;
+static uint16_t Peak;
+static uint8_t PeakAge; // updates since Peak was last raised, stops at 255
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+void trackwire_update(uint16_t front, uint16_t back) {
+    if (!Started) {
+        // start the filters on the first reading rather than ramping up from 0
+        FrontFilter = (uint32_t) front << TRACKWIRE_FILTER_SHIFT;
+        BackFilter = (uint32_t) back << TRACKWIRE_FILTER_SHIFT;
+        Started = TRUE;
+    } else {
+        FrontFilter += front - (FrontFilter >> TRACKWIRE_FILTER_SHIFT);
+        BackFilter += back - (BackFilter >> TRACKWIRE_FILTER_SHIFT);
+    }
+    Front = FrontFilter >> TRACKWIRE_FILTER_SHIFT;
+    Back = BackFilter >> TRACKWIRE_FILTER_SHIFT;
+    Strength = Front + Back;
+    if (Strength == 0) {
+        Error = 0;
+    } else {
+        Error = ((int32_t) Front - (int32_t) Back) * TRACKWIRE_ERROR_SCALE / Strength;
+    }
+    if (Strength > Peak) {
+        Peak = Strength;
+        PeakAge = 0;
+    } else if (PeakAge < UINT8_MAX) {
+        PeakAge++;
+    }
+}
+
+uint16_t trackwire_get_front() {
+    return Front;
+}
+
+uint16_t trackwire_get_back() {
+    return Back;
+}
+
+uint16_t trackwire_get_strength() {
+    return Strength;
+}
+
+int16_t trackwire_get_error() {
+    return Error;
+}
+
+void trackwire_reset_peak() {
+    Peak = Strength;
+    PeakAge = 0;
+}
+
+uint8_t trackwire_is_aligned() {
+    int16_t error = Error;
+
+    if ((error >= TRACKWIRE_ALIGNED_ERROR) || (error <= -TRACKWIRE_ALIGNED_ERROR)) {
+        return FALSE;
+    }
+    if (PeakAge < TRACKWIRE_PEAK_HOLD) {
+        return FALSE; // still rising, the peak is wherever the signal is
+    }
+    return (Strength >= Peak - (Peak >> TRACKWIRE_PEAK_SHIFT));
+}
@@ -0,0 +1,81 @@
+/*
+ * File:   trackwire.h
+ *
+ * Filtered trackwire readings. Both coils go through a low pass filter, and
+ * their difference is divided by their sum, so the alignment error reads the
+ * same near the wire as further off it. The running peak of the summed
+ * signal is kept as well, so alignment is only taken once the field has
+ * stopped getting stronger, and not where the two coils happen to read the
+ * same far from it.
+ */
+
+#ifndef TRACKWIRE_H
+#define	TRACKWIRE_H
+
+#include "BOARD.h"
+
+/*******************************************************************************
+ * PUBLIC #DEFINES                                                             *
+ ******************************************************************************/
+// the error is (front - back) / (front + back) in these units, so +-1000
+#define TRACKWIRE_ERROR_SCALE 1000
+// aligned within this much error (2%, about the old 20 counts at 600 each)
+#define TRACKWIRE_ALIGNED_ERROR 20
+// and with the summed signal within 1 / 2^this of the peak
+#define TRACKWIRE_PEAK_SHIFT 3
+// and with the peak not raised for this many updates, so the signal has
+// stopped rising (a rising signal is always at its own peak)
+#define TRACKWIRE_PEAK_HOLD 4
+
+/*******************************************************************************
+ * PUBLIC FUNCTION PROTOTYPES                                                  *
+ ******************************************************************************/
+
+/**
+ * @Function trackwire_update(uint16_t front, uint16_t back)
+ * @param front - raw A/D reading of the front coil
+ * @param back - raw A/D reading of the back coil
+ * @return None.
+ * @brief  Runs both readings through the filter and works out the error and
+ *         the peak. Called once per trackwire sample, it is short enough for
+ *         the periodic task interrupt. */
+void trackwire_update(uint16_t front, uint16_t back);
+
+/**
+ * @Function trackwire_get_front(void)
+ * @return the filtered front coil reading */
+uint16_t trackwire_get_front();
+
+/**
+ * @Function trackwire_get_back(void)
+ * @return the filtered back coil reading */
+uint16_t trackwire_get_back();
+
+/**
+ * @Function trackwire_get_strength(void)
+ * @return the filtered front and back readings added together */
+uint16_t trackwire_get_strength();
+
+/**
+ * @Function trackwire_get_error(void)
+ * @return the signed alignment error, (front - back) / (front + back) in
+ *         TRACKWIRE_ERROR_SCALE units. Positive when the front coil is nearer
+ *         the wire, so the robot has to go forwards. */
+int16_t trackwire_get_error();
+
+/**
+ * @Function trackwire_reset_peak(void)
+ * @param None.
+ * @return None.
+ * @brief  forgets the peak, done each time the wire is found again */
+void trackwire_reset_peak();
+
+/**
+ * @Function trackwire_is_aligned(void)
+ * @param None.
+ * @return TRUE if the error is within TRACKWIRE_ALIGNED_ERROR and the signal
+ *         is near a peak it has held for TRACKWIRE_PEAK_HOLD updates, FALSE
+ *         otherwise */
+uint8_t trackwire_is_aligned();
+
+#endif	/* TRACKWIRE_H */